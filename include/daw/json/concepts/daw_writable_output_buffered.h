@@ -0,0 +1,218 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#pragma once
+
+#include <daw/json/impl/version.h>
+
+#include "daw_writable_output_fwd.h"
+#include <daw/json/impl/daw_json_assert.h>
+
+#include <daw/daw_string_view.h>
+
+#include <cerrno>
+#include <cstddef>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <ostream>
+#include <streambuf>
+#include <utility>
+
+#if defined( DAW_HAS_MSVC_LIKE )
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+namespace daw::json {
+	inline namespace DAW_JSON_VER {
+		/// @brief Writes chunks to a FILE * with fwrite
+		struct json_file_sink {
+			std::FILE *fp;
+
+			void operator( )( char const *first, std::size_t size ) const {
+				auto const ret = std::fwrite( first, 1, size, fp );
+				daw_json_ensure( ret == size, ErrorReason::OutputError );
+			}
+
+			void flush( ) const {
+				daw_json_ensure( std::fflush( fp ) == 0, ErrorReason::OutputError );
+			}
+		};
+
+		/// @brief Writes chunks to a file descriptor with write(2), retrying
+		/// partial and interrupted writes
+		struct json_fd_sink {
+			int fd;
+
+			void operator( )( char const *first, std::size_t size ) const {
+				while( size > 0 ) {
+#if defined( DAW_HAS_MSVC_LIKE )
+					auto const ret =
+					  ::_write( fd, first, static_cast<unsigned>( size ) );
+#else
+					auto const ret = ::write( fd, first, size );
+#endif
+					if( ret < 0 and errno == EINTR ) {
+						continue;
+					}
+					daw_json_ensure( ret > 0, ErrorReason::OutputError );
+					first += ret;
+					size -= static_cast<std::size_t>( ret );
+				}
+			}
+
+			void flush( ) const {}
+		};
+
+		/// @brief Writes chunks directly to the streambuf of an ostream with
+		/// sputn.  The ostream's sentry, formatting and state are bypassed
+		struct json_streambuf_sink {
+			std::streambuf *buf;
+
+			explicit json_streambuf_sink( std::streambuf *sb )
+			  : buf( sb ) {
+				daw_json_ensure( buf != nullptr, ErrorReason::OutputError );
+			}
+
+			explicit json_streambuf_sink( std::ostream &os )
+			  : json_streambuf_sink( os.rdbuf( ) ) {}
+
+			void operator( )( char const *first, std::size_t size ) const {
+				auto const ret =
+				  buf->sputn( first, static_cast<std::streamsize>( size ) );
+				daw_json_ensure( ret == static_cast<std::streamsize>( size ),
+				                 ErrorReason::OutputError );
+			}
+
+			void flush( ) const {
+				daw_json_ensure( buf->pubsync( ) == 0, ErrorReason::OutputError );
+			}
+		};
+
+		/***
+		 * A writable output that accumulates the output in a buffer and passes
+		 * it to Sink in chunks of the buffer size.  Output larger than the
+		 * buffer is passed through without being copied.  The remaining output
+		 * is written by flush( ), or the destructor, which ignores errors.
+		 * @tparam Sink Callable with a char const * and size, with a flush( )
+		 * member
+		 */
+		template<typename Sink>
+		class basic_buffered_writer {
+			Sink m_sink;
+			std::unique_ptr<char[]> m_buffer;
+			std::size_t m_capacity;
+			std::size_t m_size = 0;
+
+			void write_buffer( ) {
+				if( m_size > 0 ) {
+					auto const size = std::exchange( m_size, 0 );
+					m_sink( m_buffer.get( ), size );
+				}
+			}
+
+		public:
+			static constexpr std::size_t default_buffer_size = 64U * 1024U;
+
+			explicit basic_buffered_writer(
+			  Sink sink, std::size_t buffer_size = default_buffer_size )
+			  : m_sink( std::move( sink ) )
+			  , m_buffer( new char[buffer_size > 0 ? buffer_size : 1] )
+			  , m_capacity( buffer_size > 0 ? buffer_size : 1 ) {}
+
+			basic_buffered_writer( basic_buffered_writer const & ) = delete;
+			basic_buffered_writer &
+			operator=( basic_buffered_writer const & ) = delete;
+
+			~basic_buffered_writer( ) {
+#if defined( DAW_USE_EXCEPTIONS )
+				try {
+#endif
+					write_buffer( );
+#if defined( DAW_USE_EXCEPTIONS )
+				} catch( ... ) {}
+#endif
+			}
+
+			void write( daw::string_view sv ) {
+				if( sv.empty( ) ) {
+					return;
+				}
+				if( sv.size( ) > m_capacity - m_size ) {
+					write_buffer( );
+					if( sv.size( ) >= m_capacity ) {
+						m_sink( std::data( sv ), std::size( sv ) );
+						return;
+					}
+				}
+				std::memcpy( m_buffer.get( ) + m_size, std::data( sv ),
+				             std::size( sv ) );
+				m_size += sv.size( );
+			}
+
+			void put( char c ) {
+				if( m_size == m_capacity ) {
+					write_buffer( );
+				}
+				m_buffer[m_size++] = c;
+			}
+
+			/// @brief Write the buffered output to the sink and flush it
+			void flush( ) {
+				write_buffer( );
+				m_sink.flush( );
+			}
+
+			/// @brief The number of bytes waiting to be written
+			[[nodiscard]] std::size_t buffered_size( ) const {
+				return m_size;
+			}
+
+			[[nodiscard]] std::size_t capacity( ) const {
+				return m_capacity;
+			}
+
+			[[nodiscard]] Sink const &sink( ) const {
+				return m_sink;
+			}
+		};
+
+		/// @brief Buffered output to a FILE *.  Flushing also calls fflush
+		using buffered_file_writer = basic_buffered_writer<json_file_sink>;
+
+		/// @brief Buffered output to a file descriptor, bypassing stdio
+		using buffered_fd_writer = basic_buffered_writer<json_fd_sink>;
+
+		/// @brief Buffered output to an ostream that only makes a virtual
+		/// streambuf call per chunk.  Flushing also syncs the streambuf
+		using buffered_ostream_writer = basic_buffered_writer<json_streambuf_sink>;
+
+		namespace concepts {
+			/// @brief Specialization for basic_buffered_writer
+			template<typename Sink>
+			struct writable_output_trait<basic_buffered_writer<Sink>>
+			  : std::true_type {
+
+				template<typename... StringViews>
+				static inline void write( basic_buffered_writer<Sink> &out,
+				                          StringViews const &...svs ) {
+					static_assert( sizeof...( StringViews ) > 0 );
+					( out.write( daw::string_view( std::data( svs ),
+					                               std::size( svs ) ) ),
+					  ... );
+				}
+
+				static inline void put( basic_buffered_writer<Sink> &out, char c ) {
+					out.put( c );
+				}
+			};
+		} // namespace concepts
+	} // namespace DAW_JSON_VER
+} // namespace daw::json
@@ -53,10 +53,11 @@ namespace daw::json {
 			using ParsePolicy =
 			  BasicParsePolicy<options::parse_flags_t<PolicyFlags...>::value>;
 
-			/// If the string is known to have a trailing zero, allow optimization on
-			/// that
+			/// If the string is known to have a trailing zero or padding, allow
+			/// optimization on that
 			using policy_zstring_t = json_details::apply_zstring_policy_option_t<
-			  ParsePolicy, String, options::ZeroTerminatedString::yes>;
+			  json_details::apply_padded_policy_option_t<ParsePolicy, String>,
+			  String, options::ZeroTerminatedString::yes>;
 
 			using ParseState =
 			  daw::conditional_t<policy_zstring_t::is_default_parse_policy,
@@ -135,10 +136,11 @@ namespace daw::json {
 			using ParsePolicy =
 			  BasicParsePolicy<options::parse_flags_t<PolicyFlags...>::value>;
 
-			/// @brief If the string is known to have a trailing zero, allow
-			/// optimization on that
+			/// @brief If the string is known to have a trailing zero or padding,
+			/// allow optimization on that
 			using ParseState = json_details::apply_zstring_policy_option_t<
-			  ParsePolicy, String, options::ZeroTerminatedString::yes>;
+			  json_details::apply_padded_policy_option_t<ParsePolicy, String>,
+			  String, options::ZeroTerminatedString::yes>;
 
 			auto parse_state = ParseState::with_allocator( f, l, a );
 			if constexpr( ParseState::must_verify_end_of_data_is_valid ) {
@@ -210,10 +212,11 @@ namespace daw::json {
 			using ParsePolicy =
 			  BasicParsePolicy<options::parse_flags_t<PolicyFlags...>::value>;
 
-			/// @brief If the string is known to have a trailing zero, allow
-			/// optimization on that
+			/// @brief If the string is known to have a trailing zero or padding,
+			/// allow optimization on that
 			using policy_zstring_t = json_details::apply_zstring_policy_option_t<
-			  ParsePolicy, String, options::ZeroTerminatedString::yes>;
+			  json_details::apply_padded_policy_option_t<ParsePolicy, String>,
+			  String, options::ZeroTerminatedString::yes>;
 
 			using ParseState =
 			  daw::conditional_t<policy_zstring_t::is_default_parse_policy,
@@ -307,10 +310,11 @@ namespace daw::json {
 			using ParsePolicy =
 			  BasicParsePolicy<options::parse_flags_t<PolicyFlags...>::value>;
 
-			/// @brief If the string is known to have a trailing zero, allow
-			/// optimization on that
+			/// @brief If the string is known to have a trailing zero or padding,
+			/// allow optimization on that
 			using ParseState = json_details::apply_zstring_policy_option_t<
-			  ParsePolicy, String, options::ZeroTerminatedString::yes>;
+			  json_details::apply_padded_policy_option_t<ParsePolicy, String>,
+			  String, options::ZeroTerminatedString::yes>;
 
 			auto first = std::data( json_data );
 			auto last = daw::data_end( json_data );
@@ -520,10 +524,11 @@ namespace daw::json {
 			using ParsePolicy =
 			  BasicParsePolicy<options::parse_flags_t<PolicyFlags...>::value>;
 
-			/// @brief If the string is known to have a trailing zero, allow
-			/// optimization on that
+			/// @brief If the string is known to have a trailing zero or padding,
+			/// allow optimization on that
 			using policy_zstring_t = json_details::apply_zstring_policy_option_t<
-			  ParsePolicy, String, options::ZeroTerminatedString::yes>;
+			  json_details::apply_padded_policy_option_t<ParsePolicy, String>,
+			  String, options::ZeroTerminatedString::yes>;
 
 			using ParseState =
 			  daw::conditional_t<policy_zstring_t::is_default_parse_policy,
@@ -614,10 +619,11 @@ namespace daw::json {
 			using ParsePolicy =
 			  BasicParsePolicy<options::parse_flags_t<PolicyFlags...>::value>;
 
-			/// @brief If the string is known to have a trailing zero, allow
-			/// optimization on that
+			/// @brief If the string is known to have a trailing zero or padding,
+			/// allow optimization on that
 			using policy_zstring_t = json_details::apply_zstring_policy_option_t<
-			  ParsePolicy, String, options::ZeroTerminatedString::yes>;
+			  json_details::apply_padded_policy_option_t<ParsePolicy, String>,
+			  String, options::ZeroTerminatedString::yes>;
 
 			using ParseState =
 			  daw::conditional_t<policy_zstring_t::is_default_parse_policy,
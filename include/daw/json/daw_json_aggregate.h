@@ -0,0 +1,334 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#pragma once
+
+#include "impl/version.h"
+
+#include "impl/daw_json_assert.h"
+#include "impl/daw_json_parse_name.h"
+#include "impl/daw_json_parse_policy.h"
+#include "impl/daw_json_parse_value.h"
+#include "impl/daw_json_skip.h"
+
+#include <daw/daw_string_view.h>
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+namespace daw::json {
+	inline namespace DAW_JSON_VER {
+		/***
+		 * Count, sum, min and max of the values passed to it.  Use with
+		 * for_each_json_array_value/for_each_json_lines_value, or
+		 * aggregate_json_array/aggregate_json_lines
+		 * @tparam Number Type of the values.  The sum is also a Number
+		 */
+		template<typename Number>
+		class json_aggregate {
+			std::size_t m_count = 0;
+			Number m_sum{ };
+			Number m_min{ };
+			Number m_max{ };
+
+		public:
+			using value_type = Number;
+
+			constexpr void operator( )( Number value ) {
+				if( m_count == 0 ) {
+					m_min = value;
+					m_max = value;
+				} else {
+					if( value < m_min ) {
+						m_min = value;
+					}
+					if( m_max < value ) {
+						m_max = value;
+					}
+				}
+				m_sum += value;
+				++m_count;
+			}
+
+			[[nodiscard]] constexpr std::size_t count( ) const {
+				return m_count;
+			}
+
+			[[nodiscard]] constexpr Number sum( ) const {
+				return m_sum;
+			}
+
+			/// @pre count( ) > 0
+			[[nodiscard]] constexpr Number min( ) const {
+				return m_min;
+			}
+
+			/// @pre count( ) > 0
+			[[nodiscard]] constexpr Number max( ) const {
+				return m_max;
+			}
+
+			/// @pre count( ) > 0
+			[[nodiscard]] constexpr double mean( ) const {
+				return static_cast<double>( m_sum ) / static_cast<double>( m_count );
+			}
+		};
+
+		/***
+		 * Counts the values passed to it in bin_count equal width bins over
+		 * [first, last).  Values outside of it, and NaN, are counted in
+		 * underflow( ) or overflow( )
+		 * @tparam Number Type of the values
+		 */
+		template<typename Number>
+		class json_histogram {
+			Number m_first;
+			Number m_last;
+			std::vector<std::size_t> m_bins;
+			std::size_t m_underflow = 0;
+			std::size_t m_overflow = 0;
+
+		public:
+			using value_type = Number;
+
+			/// @pre first < last and bin_count > 0
+			json_histogram( Number first, Number last, std::size_t bin_count )
+			  : m_first( first )
+			  , m_last( last )
+			  , m_bins( bin_count ) {
+				daw_json_ensure( first < last and bin_count > 0,
+				                 ErrorReason::NumberOutOfRange );
+			}
+
+			void operator( )( Number value ) {
+				if( not( m_first <= value ) ) {
+					++m_underflow;
+					return;
+				}
+				if( not( value < m_last ) ) {
+					++m_overflow;
+					return;
+				}
+				auto const width =
+				  static_cast<double>( m_last ) - static_cast<double>( m_first );
+				auto bin = static_cast<std::size_t>(
+				  ( static_cast<double>( value ) - static_cast<double>( m_first ) ) /
+				  width * static_cast<double>( m_bins.size( ) ) );
+				if( bin >= m_bins.size( ) ) {
+					bin = m_bins.size( ) - 1;
+				}
+				++m_bins[bin];
+			}
+
+			/// @brief The number of values in each bin.  Bin n holds values in
+			/// [bin_first( n ), bin_first( n + 1 ))
+			[[nodiscard]] std::vector<std::size_t> const &bins( ) const {
+				return m_bins;
+			}
+
+			[[nodiscard]] double bin_first( std::size_t n ) const {
+				return static_cast<double>( m_first ) +
+				       ( static_cast<double>( m_last ) -
+				         static_cast<double>( m_first ) ) *
+				         static_cast<double>( n ) /
+				         static_cast<double>( m_bins.size( ) );
+			}
+
+			[[nodiscard]] std::size_t underflow( ) const {
+				return m_underflow;
+			}
+
+			[[nodiscard]] std::size_t overflow( ) const {
+				return m_overflow;
+			}
+
+			/// @brief The number of values counted, including underflow and
+			/// overflow
+			[[nodiscard]] std::size_t count( ) const {
+				auto result = m_underflow + m_overflow;
+				for( auto b : m_bins ) {
+					result += b;
+				}
+				return result;
+			}
+		};
+
+		namespace json_details {
+			/***
+			 * Call func with the value at path in the value at parse_state, parsed
+			 * as a Number, when it is present and not null.  The classes and
+			 * arrays on the path are walked in place and everything else is
+			 * skipped, so the value is scanned once.  parse_state is left after the
+			 * value
+			 */
+			template<typename Number, typename ParseState, typename Function>
+			constexpr void visit_json_path_number( ParseState &parse_state,
+			                                       daw::string_view path,
+			                                       Function &func ) {
+				daw_json_ensure( parse_state.has_more( ),
+				                 ErrorReason::UnexpectedEndOfData, parse_state );
+				if( path.empty( ) ) {
+					if( parse_state.front( ) == 'n' ) {
+						(void)skip_value( parse_state );
+						return;
+					}
+					using element_t = json_deduced_type<Number>;
+					func( parse_value<element_t, false, element_t::expected_type>(
+					  parse_state ) );
+					return;
+				}
+				auto segment = [&] {
+					if( path.front( ) == '[' ) {
+						return path.pop_front_until( ']' );
+					}
+					return path.pop_front_until( escaped_any_of<'.', '['>{ },
+					                             nodiscard );
+				}( );
+				if( not path.empty( ) and path.front( ) == '.' ) {
+					path.remove_prefix( );
+				}
+				bool const is_index = segment.front( ) == '[';
+				char const open = parse_state.front( );
+				if( not( open == '{' or ( is_index and open == '[' ) ) ) {
+					(void)skip_value( parse_state );
+					return;
+				}
+				std::size_t index = 0;
+				if( is_index ) {
+					segment.remove_prefix( );
+					index = parse_unsigned_int<std::size_t>( std::data( segment ),
+					                                         daw::data_end( segment ) );
+				}
+				char const close = open == '{' ? '}' : ']';
+				parse_state.remove_prefix( );
+				parse_state.trim_left( );
+				while( true ) {
+					daw_json_ensure( parse_state.has_more( ),
+					                 ErrorReason::UnexpectedEndOfData, parse_state );
+					if( parse_state.front( ) == close ) {
+						parse_state.remove_prefix( );
+						return;
+					}
+					bool is_match = index == 0;
+					if( open == '{' ) {
+						auto const name = parse_name( parse_state );
+						if( not is_index ) {
+							is_match = json_path_compare( segment, name );
+						}
+					}
+					if( is_match ) {
+						visit_json_path_number<Number>( parse_state, path, func );
+						// The rest of the class or array is skipped from inside of it
+						(void)( open == '{' ? parse_state.skip_class( )
+						                    : parse_state.skip_array( ) );
+						return;
+					}
+					if( is_index ) {
+						--index;
+					}
+					(void)skip_value( parse_state );
+					parse_state.move_next_member_or_end( );
+				}
+			}
+		} // namespace json_details
+
+		/***
+		 * Call func with the value at member_path of each element of a JSON
+		 * array, parsed as a Number.  Each element is scanned once: the classes
+		 * and arrays on member_path are walked in place, the other members and
+		 * elements are skipped, and the elements are not constructed.  Elements
+		 * where the value is missing or null are skipped.
+		 * @tparam Number Type to parse the values as
+		 * @param json_doc JSON document containing the array
+		 * @param member_path Path of the value in each element, e.g. "a.b[1]".
+		 * Empty for arrays of numbers
+		 * @param func Callable with a Number
+		 * @param array_path Path of the array in json_doc.  Empty for the root
+		 * @return func, after all elements
+		 * @throws daw::json::json_exception
+		 */
+		template<typename Number, auto... PolicyFlags, typename Function>
+		constexpr Function
+		for_each_json_array_value( daw::string_view json_doc,
+		                           daw::string_view member_path, Function func,
+		                           daw::string_view array_path = { } ) {
+			using ParseState = TryDefaultParsePolicy<BasicParsePolicy<
+			  options::details::make_parse_flags<PolicyFlags...>( ).value>>;
+			auto [parse_state, is_found] =
+			  json_details::find_range<ParseState>( json_doc, array_path );
+			daw_json_ensure( is_found, ErrorReason::JSONPathNotFound );
+			parse_state.trim_left( );
+			daw_json_ensure( parse_state.is_opening_bracket_checked( ),
+			                 ErrorReason::InvalidArrayStart, parse_state );
+			parse_state.remove_prefix( );
+			parse_state.trim_left( );
+			while( true ) {
+				daw_json_ensure( parse_state.has_more( ),
+				                 ErrorReason::UnexpectedEndOfData, parse_state );
+				if( parse_state.front( ) == ']' ) {
+					break;
+				}
+				json_details::visit_json_path_number<Number>( parse_state,
+				                                              member_path, func );
+				parse_state.move_next_member_or_end( );
+			}
+			return func;
+		}
+
+		/***
+		 * Call func with the value at member_path of each record of a JSON Lines
+		 * document, parsed as a Number.  Each record is scanned once, as with
+		 * for_each_json_array_value, and the records are not constructed.
+		 * Records where the value is missing or null are skipped.
+		 * @tparam Number Type to parse the values as
+		 * @param json_lines_doc JSON Lines document
+		 * @param member_path Path of the value in each record, e.g. "a.b[1]"
+		 * @param func Callable with a Number
+		 * @return func, after all records
+		 * @throws daw::json::json_exception
+		 */
+		template<typename Number, auto... PolicyFlags, typename Function>
+		constexpr Function
+		for_each_json_lines_value( daw::string_view json_lines_doc,
+		                           daw::string_view member_path, Function func ) {
+			using ParseState = TryDefaultParsePolicy<BasicParsePolicy<
+			  options::details::make_parse_flags<PolicyFlags...>( ).value>>;
+			auto parse_state = ParseState( std::data( json_lines_doc ),
+			                               daw::data_end( json_lines_doc ) );
+			parse_state.trim_left( );
+			while( not parse_state.is_null( ) and parse_state.has_more( ) ) {
+				json_details::visit_json_path_number<Number>( parse_state,
+				                                              member_path, func );
+				parse_state.move_next_member_or_end( );
+			}
+			return func;
+		}
+
+		/// @brief The count, sum, min and max of the value at member_path of each
+		/// element of a JSON array.  See for_each_json_array_value
+		template<typename Number, auto... PolicyFlags>
+		[[nodiscard]] constexpr json_aggregate<Number>
+		aggregate_json_array( daw::string_view json_doc,
+		                      daw::string_view member_path,
+		                      daw::string_view array_path = { } ) {
+			return for_each_json_array_value<Number, PolicyFlags...>(
+			  json_doc, member_path, json_aggregate<Number>{ }, array_path );
+		}
+
+		/// @brief The count, sum, min and max of the value at member_path of each
+		/// record of a JSON Lines document.  See for_each_json_lines_value
+		template<typename Number, auto... PolicyFlags>
+		[[nodiscard]] constexpr json_aggregate<Number>
+		aggregate_json_lines( daw::string_view json_lines_doc,
+		                      daw::string_view member_path ) {
+			return for_each_json_lines_value<Number, PolicyFlags...>(
+			  json_lines_doc, member_path, json_aggregate<Number>{ } );
+		}
+	} // namespace DAW_JSON_VER
+} // namespace daw::json
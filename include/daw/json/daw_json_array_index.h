@@ -0,0 +1,363 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#pragma once
+
+#include "impl/version.h"
+
+#include "impl/daw_json_assert.h"
+#include "impl/daw_json_link_types_fwd.h"
+#include "impl/daw_json_parse_class.h"
+#include "impl/daw_json_parse_name.h"
+#include "impl/daw_json_parse_value_fwd.h"
+#include "impl/daw_json_skip.h"
+#include "impl/daw_json_value.h"
+
+#include <daw/daw_string_view.h>
+
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <string_view>
+#include <vector>
+
+namespace daw::json {
+	inline namespace DAW_JSON_VER {
+		template<typename JsonElement, auto... PolicyFlags>
+		class json_array_index;
+
+		/// @brief Random access iterator over the elements of a json_array_index.
+		/// Dereferencing parses the element
+		template<typename JsonElement, auto... PolicyFlags>
+		class json_array_index_iterator {
+			using index_t = json_array_index<JsonElement, PolicyFlags...>;
+
+			index_t const *m_index = nullptr;
+			std::size_t m_pos = 0;
+
+		public:
+			using value_type = typename index_t::value_type;
+			using reference = value_type;
+			using pointer = json_details::arrow_proxy<value_type>;
+			using difference_type = std::ptrdiff_t;
+			using iterator_category = std::random_access_iterator_tag;
+
+			explicit json_array_index_iterator( ) = default;
+
+			explicit constexpr json_array_index_iterator( index_t const &index,
+			                                              std::size_t pos )
+			  : m_index( &index )
+			  , m_pos( pos ) {}
+
+			[[nodiscard]] constexpr std::size_t position( ) const {
+				return m_pos;
+			}
+
+			[[nodiscard]] constexpr value_type operator*( ) const {
+				return ( *m_index )[m_pos];
+			}
+
+			[[nodiscard]] constexpr pointer operator->( ) const {
+				return pointer{ operator*( ) };
+			}
+
+			[[nodiscard]] constexpr value_type
+			operator[]( difference_type n ) const {
+				return ( *m_index )[static_cast<std::size_t>(
+				  static_cast<difference_type>( m_pos ) + n )];
+			}
+
+			constexpr json_array_index_iterator &operator++( ) {
+				++m_pos;
+				return *this;
+			}
+
+			constexpr json_array_index_iterator operator++( int ) {
+				auto result = *this;
+				++m_pos;
+				return result;
+			}
+
+			constexpr json_array_index_iterator &operator--( ) {
+				--m_pos;
+				return *this;
+			}
+
+			constexpr json_array_index_iterator operator--( int ) {
+				auto result = *this;
+				--m_pos;
+				return result;
+			}
+
+			constexpr json_array_index_iterator &operator+=( difference_type n ) {
+				m_pos = static_cast<std::size_t>(
+				  static_cast<difference_type>( m_pos ) + n );
+				return *this;
+			}
+
+			constexpr json_array_index_iterator &operator-=( difference_type n ) {
+				return operator+=( -n );
+			}
+
+			[[nodiscard]] friend constexpr json_array_index_iterator
+			operator+( json_array_index_iterator it, difference_type n ) {
+				return it += n;
+			}
+
+			[[nodiscard]] friend constexpr json_array_index_iterator
+			operator+( difference_type n, json_array_index_iterator it ) {
+				return it += n;
+			}
+
+			[[nodiscard]] friend constexpr json_array_index_iterator
+			operator-( json_array_index_iterator it, difference_type n ) {
+				return it -= n;
+			}
+
+			[[nodiscard]] friend constexpr difference_type
+			operator-( json_array_index_iterator const &lhs,
+			           json_array_index_iterator const &rhs ) {
+				return static_cast<difference_type>( lhs.m_pos ) -
+				       static_cast<difference_type>( rhs.m_pos );
+			}
+
+			[[nodiscard]] friend constexpr bool
+			operator==( json_array_index_iterator const &lhs,
+			            json_array_index_iterator const &rhs ) {
+				return lhs.m_pos == rhs.m_pos;
+			}
+
+			[[nodiscard]] friend constexpr bool
+			operator!=( json_array_index_iterator const &lhs,
+			            json_array_index_iterator const &rhs ) {
+				return lhs.m_pos != rhs.m_pos;
+			}
+
+			[[nodiscard]] friend constexpr bool
+			operator<( json_array_index_iterator const &lhs,
+			           json_array_index_iterator const &rhs ) {
+				return lhs.m_pos < rhs.m_pos;
+			}
+
+			[[nodiscard]] friend constexpr bool
+			operator<=( json_array_index_iterator const &lhs,
+			            json_array_index_iterator const &rhs ) {
+				return lhs.m_pos <= rhs.m_pos;
+			}
+
+			[[nodiscard]] friend constexpr bool
+			operator>( json_array_index_iterator const &lhs,
+			           json_array_index_iterator const &rhs ) {
+				return lhs.m_pos > rhs.m_pos;
+			}
+
+			[[nodiscard]] friend constexpr bool
+			operator>=( json_array_index_iterator const &lhs,
+			            json_array_index_iterator const &rhs ) {
+				return lhs.m_pos >= rhs.m_pos;
+			}
+		};
+
+		/// @brief A sub-range [first, last) of the elements of a
+		/// json_array_index.  It refers to the index
+		template<typename JsonElement, auto... PolicyFlags>
+		struct json_array_index_slice {
+			using iterator = json_array_index_iterator<JsonElement, PolicyFlags...>;
+			using value_type = typename iterator::value_type;
+
+			iterator first;
+			iterator last;
+
+			[[nodiscard]] constexpr iterator begin( ) const {
+				return first;
+			}
+
+			[[nodiscard]] constexpr iterator end( ) const {
+				return last;
+			}
+
+			[[nodiscard]] constexpr std::size_t size( ) const {
+				return static_cast<std::size_t>( last - first );
+			}
+
+			[[nodiscard]] constexpr bool empty( ) const {
+				return first == last;
+			}
+
+			[[nodiscard]] constexpr value_type operator[]( std::size_t idx ) const {
+				return first[static_cast<std::ptrdiff_t>( idx )];
+			}
+		};
+
+		/***
+		 * An index of where each element of a JSON array starts.  It is built in
+		 * one pass that skips the elements without parsing them, and allows
+		 * parsing any element, the number of elements, and slicing, without
+		 * rescanning the array.  The index refers to the JSON document, which
+		 * must outlive it.
+		 * @tparam JsonElement Type each element is parsed to
+		 */
+		template<typename JsonElement, auto... PolicyFlags>
+		class json_array_index {
+			using ParseState = TryDefaultParsePolicy<BasicParsePolicy<
+			  options::details::make_parse_flags<PolicyFlags...>( ).value>>;
+
+		public:
+			using element_type = json_details::json_deduced_type<JsonElement>;
+			static_assert( not std::is_same_v<element_type, void>,
+			               "Unknown JsonElement type." );
+			using value_type = json_details::json_result_t<element_type>;
+			using iterator = json_array_index_iterator<JsonElement, PolicyFlags...>;
+			using slice_type = json_array_index_slice<JsonElement, PolicyFlags...>;
+
+		private:
+			char const *m_first = nullptr;
+			char const *m_last = nullptr;
+			/// The offset of each element in the document, followed by the offset
+			/// of the closing bracket of the array
+			std::vector<std::size_t> m_offsets{ };
+
+			void build( ParseState parse_state ) {
+				parse_state.trim_left( );
+				daw_json_ensure( parse_state.is_opening_bracket_checked( ),
+				                 ErrorReason::InvalidArrayStart );
+				parse_state.remove_prefix( );
+				parse_state.trim_left( );
+				while( parse_state.has_more( ) and parse_state.front( ) != ']' ) {
+					m_offsets.push_back(
+					  static_cast<std::size_t>( parse_state.first - m_first ) );
+					(void)json_details::skip_known_value<element_type>( parse_state );
+					parse_state.move_next_member_or_end( );
+				}
+				daw_json_ensure( parse_state.has_more( ),
+				                 ErrorReason::UnexpectedEndOfData );
+				m_offsets.push_back(
+				  static_cast<std::size_t>( parse_state.first - m_first ) );
+			}
+
+		public:
+			/// @brief Index the array that is the root of json_doc
+			explicit json_array_index( daw::string_view json_doc )
+			  : m_first( std::data( json_doc ) )
+			  , m_last( daw::data_end( json_doc ) ) {
+				build( ParseState( m_first, m_last ) );
+			}
+
+			/// @brief Index the array at start_path in json_doc, e.g. "a.b[1]"
+			json_array_index( daw::string_view json_doc,
+			                  daw::string_view start_path )
+			  : m_first( std::data( json_doc ) )
+			  , m_last( daw::data_end( json_doc ) ) {
+				auto [parse_state, is_found] =
+				  json_details::find_range<ParseState>( json_doc, start_path );
+				daw_json_ensure( is_found, ErrorReason::JSONPathNotFound );
+				build( parse_state );
+			}
+
+			/// @brief The number of elements
+			[[nodiscard]] std::size_t size( ) const {
+				return m_offsets.size( ) - 1;
+			}
+
+			[[nodiscard]] bool empty( ) const {
+				return size( ) == 0;
+			}
+
+			/// @brief Parse element idx
+			/// @pre idx < size( )
+			[[nodiscard]] value_type operator[]( std::size_t idx ) const {
+				daw_json_ensure( idx < size( ),
+				                 ErrorReason::AttemptToAccessPastEndOfValue );
+				auto parse_state = ParseState( m_first + m_offsets[idx], m_last );
+				return json_details::parse_value<element_type, false,
+				                                 element_type::expected_type>(
+				  parse_state );
+			}
+
+			/// @brief Parse element idx
+			/// @throws json_exception when idx >= size( )
+			[[nodiscard]] value_type at( std::size_t idx ) const {
+				return operator[]( idx );
+			}
+
+			/// @brief The JSON text of element idx
+			/// @pre idx < size( )
+			[[nodiscard]] std::string_view raw_element( std::size_t idx ) const {
+				daw_json_ensure( idx < size( ),
+				                 ErrorReason::AttemptToAccessPastEndOfValue );
+				char const *const first = m_first + m_offsets[idx];
+				char const *last = m_first + m_offsets[idx + 1];
+				// Remove the whitespace and comma between this element and the next
+				auto const is_separator = []( char c ) {
+					return c == ' ' or c == '\t' or c == '\n' or c == '\r' or c == ',';
+				};
+				while( last > first and is_separator( last[-1] ) ) {
+					--last;
+				}
+				return std::string_view( first,
+				                         static_cast<std::size_t>( last - first ) );
+			}
+
+			/// @brief A json_value of element idx, for querying it without parsing
+			/// all of it
+			/// @pre idx < size( )
+			[[nodiscard]] json_value element_value( std::size_t idx ) const {
+				return json_value( daw::string_view( raw_element( idx ) ) );
+			}
+
+			[[nodiscard]] iterator begin( ) const {
+				return iterator( *this, 0 );
+			}
+
+			[[nodiscard]] iterator end( ) const {
+				return iterator( *this, size( ) );
+			}
+
+			/// @brief The elements [pos, pos + count), or to the end when there are
+			/// fewer
+			[[nodiscard]] slice_type slice( std::size_t pos,
+			                                std::size_t count ) const {
+				daw_json_ensure( pos <= size( ),
+				                 ErrorReason::AttemptToAccessPastEndOfValue );
+				auto const last = count < size( ) - pos ? pos + count : size( );
+				return slice_type{ iterator( *this, pos ), iterator( *this, last ) };
+			}
+
+			/***
+			 * Find the first element whose member at member_path is not less than
+			 * key, parsing only that member of the elements visited
+			 * @pre The elements are sorted by the member at member_path and it is
+			 * in each element
+			 * @param member_path Path of the key in each element, e.g. "a.b[1]".
+			 * Empty for arrays of keys
+			 * @return The index of the element, or size( ) when all are less
+			 */
+			template<typename Key, typename Compare = std::less<>>
+			[[nodiscard]] std::size_t
+			lower_bound( daw::string_view member_path, Key const &key,
+			             Compare compare = Compare{ } ) const {
+				std::size_t first = 0;
+				std::size_t count = size( );
+				while( count > 0 ) {
+					auto const step = count / 2;
+					auto const jv =
+					  element_value( first + step ).find_member( member_path );
+					daw_json_ensure( static_cast<bool>( jv ),
+					                 ErrorReason::MemberNotFound );
+					if( compare( jv.template as<Key>( ), key ) ) {
+						first += step + 1;
+						count -= step + 1;
+					} else {
+						count = step;
+					}
+				}
+				return first;
+			}
+		};
+	} // namespace DAW_JSON_VER
+} // namespace daw::json
@@ -0,0 +1,439 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#pragma once
+
+#include "impl/version.h"
+
+#if __has_include( <version> )
+#include <version>
+#endif
+
+#if defined( __cpp_impl_coroutine ) and defined( __cpp_lib_coroutine )
+#if __cpp_impl_coroutine >= 201902L and __cpp_lib_coroutine >= 201902L
+#define DAW_JSON_HAS_COROUTINES
+#endif
+#endif
+
+#if defined( DAW_JSON_HAS_COROUTINES )
+
+#include "daw_json_iterator.h"
+#include "daw_json_lines_iterator.h"
+#include "impl/daw_json_assert.h"
+
+#include <daw/daw_string_view.h>
+
+#include <algorithm>
+#include <coroutine>
+#include <cstddef>
+#include <cstring>
+#include <exception>
+#include <optional>
+#include <utility>
+#include <vector>
+
+namespace daw::json {
+	inline namespace DAW_JSON_VER {
+		/// @brief A coroutine generator whose producer may suspend on an
+		/// asynchronous source.  The consumer is a coroutine too and reads the
+		/// values with co_await gen.next( ), which gives an empty optional at the
+		/// end.
+		/// @tparam T The type of the values produced
+		template<typename T>
+		class json_async_generator {
+		public:
+			using value_type = T;
+
+			struct promise_type {
+				std::optional<T> m_value{ };
+				std::coroutine_handle<> m_consumer{ };
+#if defined( DAW_USE_EXCEPTIONS )
+				std::exception_ptr m_exception{ };
+#endif
+
+				struct transfer_to_consumer {
+					[[nodiscard]] constexpr bool await_ready( ) const noexcept {
+						return false;
+					}
+
+					[[nodiscard]] std::coroutine_handle<>
+					await_suspend( std::coroutine_handle<promise_type> h ) noexcept {
+						return h.promise( ).m_consumer;
+					}
+
+					constexpr void await_resume( ) const noexcept {}
+				};
+
+				[[nodiscard]] json_async_generator get_return_object( ) {
+					return json_async_generator(
+					  std::coroutine_handle<promise_type>::from_promise( *this ) );
+				}
+
+				[[nodiscard]] std::suspend_always initial_suspend( ) const noexcept {
+					return { };
+				}
+
+				[[nodiscard]] transfer_to_consumer final_suspend( ) const noexcept {
+					return { };
+				}
+
+				transfer_to_consumer yield_value( T value ) {
+					m_value.emplace( std::move( value ) );
+					return { };
+				}
+
+				void return_void( ) const noexcept {}
+
+				void unhandled_exception( ) {
+#if defined( DAW_USE_EXCEPTIONS )
+					m_exception = std::current_exception( );
+#else
+					std::terminate( );
+#endif
+				}
+			};
+
+			using handle_type = std::coroutine_handle<promise_type>;
+
+		private:
+			handle_type m_handle{ };
+
+		public:
+			/// @brief Awaiting resumes the producer until it has the next value or
+			/// is complete.  Errors in the producer are rethrown here.
+			struct next_awaiter {
+				handle_type m_handle;
+
+				[[nodiscard]] bool await_ready( ) const noexcept {
+					return not m_handle or m_handle.done( );
+				}
+
+				[[nodiscard]] std::coroutine_handle<>
+				await_suspend( std::coroutine_handle<> consumer ) noexcept {
+					m_handle.promise( ).m_consumer = consumer;
+					m_handle.promise( ).m_value.reset( );
+					return m_handle;
+				}
+
+				[[nodiscard]] std::optional<T> await_resume( ) {
+					if( not m_handle ) {
+						return std::nullopt;
+					}
+					auto &promise = m_handle.promise( );
+#if defined( DAW_USE_EXCEPTIONS )
+					if( promise.m_exception ) {
+						std::rethrow_exception( std::exchange( promise.m_exception, { } ) );
+					}
+#endif
+					auto result = std::move( promise.m_value );
+					promise.m_value.reset( );
+					return result;
+				}
+			};
+
+			json_async_generator( ) = default;
+
+			explicit json_async_generator( handle_type h ) noexcept
+			  : m_handle( h ) {}
+
+			json_async_generator( json_async_generator &&other ) noexcept
+			  : m_handle( std::exchange( other.m_handle, { } ) ) {}
+
+			json_async_generator &operator=( json_async_generator &&rhs ) noexcept {
+				if( this != &rhs ) {
+					if( m_handle ) {
+						m_handle.destroy( );
+					}
+					m_handle = std::exchange( rhs.m_handle, { } );
+				}
+				return *this;
+			}
+
+			json_async_generator( json_async_generator const & ) = delete;
+			json_async_generator &operator=( json_async_generator const & ) = delete;
+
+			~json_async_generator( ) {
+				if( m_handle ) {
+					m_handle.destroy( );
+				}
+			}
+
+			/// @brief Get the next value.  Must be co_await'ed from a coroutine
+			/// @return An awaitable whose result is a std::optional<T>, empty when
+			/// there are no more values
+			[[nodiscard]] next_awaiter next( ) {
+				return next_awaiter{ m_handle };
+			}
+
+			/// @brief Has the producer completed
+			[[nodiscard]] bool done( ) const {
+				return not m_handle or m_handle.done( );
+			}
+		};
+
+		namespace json_details {
+			/// @brief Tracks the structure of a JSON array's contents as the bytes
+			/// arrive, so that complete elements can be parsed before the whole
+			/// array is available
+			struct async_array_scanner {
+				std::size_t depth = 0;
+				bool is_in_string = false;
+				bool is_escaped = false;
+
+				struct result_t {
+					/// The last ',' between elements, or nullptr
+					char *last_separator = nullptr;
+					/// The closing ']' of the array, or nullptr
+					char *array_end = nullptr;
+					/// Where scanning stopped
+					char *position = nullptr;
+				};
+
+				[[nodiscard]] constexpr result_t scan( char *first, char *last ) {
+					auto result = result_t{ };
+					for( ; first != last; ++first ) {
+						char const c = *first;
+						if( is_in_string ) {
+							if( is_escaped ) {
+								is_escaped = false;
+							} else if( c == '\\' ) {
+								is_escaped = true;
+							} else if( c == '"' ) {
+								is_in_string = false;
+							}
+							continue;
+						}
+						switch( c ) {
+						case '"':
+							is_in_string = true;
+							break;
+						case '[':
+						case '{':
+							++depth;
+							break;
+						case ']':
+							if( depth == 0 ) {
+								result.array_end = first;
+								result.position = first;
+								return result;
+							}
+							--depth;
+							break;
+						case '}':
+							daw_json_ensure( depth > 0, ErrorReason::InvalidBracketing );
+							--depth;
+							break;
+						case ',':
+							if( depth == 0 ) {
+								result.last_separator = first;
+							}
+							break;
+						default:
+							break;
+						}
+					}
+					result.position = last;
+					return result;
+				}
+			};
+
+			/// @brief The buffer of an async range.  Holds the unparsed bytes and
+			/// makes room for the next read
+			struct async_read_buffer {
+				std::vector<char> data;
+				std::size_t size = 0;
+
+				explicit async_read_buffer( std::size_t initial_size )
+				  : data( ( std::max )( initial_size, std::size_t{ 16 } ) ) {}
+
+				/// @brief Discard the bytes before keep_from and grow when full.
+				/// @return The number of bytes discarded
+				std::size_t make_room( std::size_t keep_from ) {
+					if( keep_from > 0 ) {
+						std::memmove( data.data( ), data.data( ) + keep_from,
+						              size - keep_from );
+						size -= keep_from;
+					}
+					if( size == data.size( ) ) {
+						data.resize( data.size( ) * 2U );
+					}
+					return keep_from;
+				}
+
+				/// @brief The buffered bytes in [first, last)
+				[[nodiscard]] daw::string_view view( std::size_t first,
+				                                     std::size_t last ) const {
+					return daw::string_view( data.data( ) + first, last - first );
+				}
+
+				[[nodiscard]] char *read_position( ) {
+					return data.data( ) + size;
+				}
+
+				[[nodiscard]] std::size_t read_capacity( ) const {
+					return data.size( ) - size;
+				}
+			};
+
+			template<typename JsonElement>
+			using async_range_value_t = json_result_t<json_deduced_type<JsonElement>>;
+		} // namespace json_details
+
+		/// @brief Parse the elements of a JSON array from an asynchronous source.
+		/// Elements are parsed, with json_array_iterator, as soon as they are
+		/// complete and the generator suspends on the source when it needs more
+		/// data instead of blocking.
+		/// @tparam JsonElement The element type of the array
+		/// @tparam PolicyFlags Parse policy flags, as in json_array_range
+		/// @param reader Called as reader( char * buffer, std::size_t capacity )
+		/// and returns an awaitable of the number of bytes read, 0 at the end
+		/// of data.  It must outlive the generator if it is a reference
+		/// @param initial_buffer_size The initial buffer size.  The buffer grows
+		/// when a single element does not fit
+		/// @pre Values that refer to the document, e.g. std::string_view or
+		/// json_value, are only valid until the generator is resumed again
+		template<typename JsonElement = json_value, auto... PolicyFlags,
+		         typename Reader>
+		json_async_generator<json_details::async_range_value_t<JsonElement>>
+		json_array_async_range( Reader reader,
+		                        std::size_t initial_buffer_size = 4096U ) {
+			using range_t = json_array_range<JsonElement, PolicyFlags...>;
+
+			auto buffer = json_details::async_read_buffer( initial_buffer_size );
+			auto scanner = json_details::async_array_scanner{ };
+			// The first unscanned byte
+			std::size_t scan_pos = 0;
+			// The byte before the unparsed elements, the opening '[' or a ','.  It
+			// is overwritten with '[' to parse the next batch of elements
+			std::size_t batch_pos = 0;
+			bool has_array_start = false;
+			bool is_eof = false;
+			while( true ) {
+				if( not has_array_start ) {
+					while( scan_pos < buffer.size and
+					       static_cast<unsigned char>( buffer.data[scan_pos] ) <= 0x20U ) {
+						++scan_pos;
+					}
+					if( scan_pos < buffer.size ) {
+						daw_json_ensure( buffer.data[scan_pos] == '[',
+						                 ErrorReason::InvalidArrayStart );
+						batch_pos = scan_pos;
+						++scan_pos;
+						has_array_start = true;
+					}
+				}
+				if( has_array_start ) {
+					char *const first = buffer.data.data( );
+					auto const scanned =
+					  scanner.scan( first + scan_pos, first + buffer.size );
+					scan_pos = static_cast<std::size_t>( scanned.position - first );
+					if( scanned.array_end ) {
+						first[batch_pos] = '[';
+						auto const array_end =
+						  static_cast<std::size_t>( scanned.array_end - first );
+						for( auto &&value :
+						     range_t( buffer.view( batch_pos, array_end + 1 ) ) ) {
+							co_yield std::move( value );
+						}
+						co_return;
+					}
+					if( scanned.last_separator ) {
+						first[batch_pos] = '[';
+						*scanned.last_separator = ']';
+						auto const separator =
+						  static_cast<std::size_t>( scanned.last_separator - first );
+						for( auto &&value :
+						     range_t( buffer.view( batch_pos, separator + 1 ) ) ) {
+							co_yield std::move( value );
+						}
+						batch_pos = separator;
+					}
+				}
+				daw_json_ensure( not is_eof,
+				                 has_array_start ? ErrorReason::UnexpectedEndOfData
+				                                 : ErrorReason::EmptyJSONDocument );
+				auto const removed =
+				  buffer.make_room( has_array_start ? batch_pos : scan_pos );
+				scan_pos -= removed;
+				if( has_array_start ) {
+					batch_pos -= removed;
+				}
+				std::size_t const count = co_await reader( buffer.read_position( ),
+				                                           buffer.read_capacity( ) );
+				if( count == 0 ) {
+					is_eof = true;
+				} else {
+					buffer.size += count;
+				}
+			}
+		}
+
+		/// @brief Parse the lines of a JSON Lines document from an asynchronous
+		/// source.  Complete lines are parsed, with json_lines_iterator, as they
+		/// arrive and the generator suspends on the source when it needs more
+		/// data instead of blocking.
+		/// @tparam JsonElement The type of each line
+		/// @tparam PolicyFlags Parse policy flags, as in json_lines_range
+		/// @param reader Called as reader( char * buffer, std::size_t capacity )
+		/// and returns an awaitable of the number of bytes read, 0 at the end
+		/// of data.  It must outlive the generator if it is a reference
+		/// @param initial_buffer_size The initial buffer size.  The buffer grows
+		/// when a single line does not fit
+		/// @pre Values that refer to the document, e.g. std::string_view or
+		/// json_value, are only valid until the generator is resumed again
+		template<typename JsonElement = json_value, auto... PolicyFlags,
+		         typename Reader>
+		json_async_generator<json_details::async_range_value_t<JsonElement>>
+		json_lines_async_range( Reader reader,
+		                        std::size_t initial_buffer_size = 4096U ) {
+			using range_t = json_lines_range<JsonElement, PolicyFlags...>;
+
+			auto buffer = json_details::async_read_buffer( initial_buffer_size );
+			// The first unscanned byte
+			std::size_t scan_pos = 0;
+			// The first byte of the unparsed lines
+			std::size_t batch_pos = 0;
+			while( true ) {
+				char *const first = buffer.data.data( );
+				char *last_newline = nullptr;
+				for( char *it = first + buffer.size; it != first + scan_pos; ) {
+					--it;
+					if( *it == '\n' ) {
+						last_newline = it;
+						break;
+					}
+				}
+				scan_pos = buffer.size;
+				if( last_newline ) {
+					auto const batch_last =
+					  static_cast<std::size_t>( last_newline - first ) + 1U;
+					for( auto &&value : range_t( buffer.view( batch_pos, batch_last ) ) ) {
+						co_yield std::move( value );
+					}
+					batch_pos = batch_last;
+				}
+				auto const removed = buffer.make_room( batch_pos );
+				scan_pos -= removed;
+				batch_pos -= removed;
+				std::size_t const count = co_await reader( buffer.read_position( ),
+				                                           buffer.read_capacity( ) );
+				if( count == 0 ) {
+					// The last line does not need a trailing newline
+					for( auto &&value :
+					     range_t( buffer.view( batch_pos, buffer.size ) ) ) {
+						co_yield std::move( value );
+					}
+					co_return;
+				}
+				buffer.size += count;
+			}
+		}
+	} // namespace DAW_JSON_VER
+} // namespace daw::json
+
+#endif
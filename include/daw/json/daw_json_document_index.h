@@ -0,0 +1,453 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#pragma once
+
+#include "impl/version.h"
+
+#include "daw_json_find_paths.h"
+#include "impl/daw_json_assert.h"
+#include "impl/daw_json_parse_name.h"
+#include "impl/daw_json_skip.h"
+#include "impl/daw_json_value.h"
+
+#include <daw/daw_data_end.h>
+#include <daw/daw_string_view.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <string_view>
+#include <vector>
+
+namespace daw::json {
+	inline namespace DAW_JSON_VER {
+		/// @brief One value in the tape of a json_document_index.  Offsets are
+		/// from the start of the document and indices are into the tape.
+		struct json_tape_entry {
+			using offset_t = std::uint32_t;
+
+			/// Offset of the first character of the value
+			offset_t value_first = 0;
+			/// Offset one past the last character of the value.  For classes and
+			/// arrays this is one past the matching bracket
+			offset_t value_last = 0;
+			/// Offset of the member name, inside the quotes, when the value is a
+			/// class member
+			offset_t name_first = 0;
+			offset_t name_size = 0;
+			/// Tape index one past the last value of this values subtree.
+			offset_t next = 0;
+			/// Number of members/elements for classes and arrays
+			offset_t child_count = 0;
+			/// Position of the first child in the child tables
+			offset_t first_child = 0;
+			JsonBaseParseTypes type = JsonBaseParseTypes::None;
+		};
+
+		template<json_options_t PolicyFlags = json_details::default_policy_flag>
+		class basic_json_document_index;
+
+		/// @brief A value in a basic_json_document_index.  Member and element
+		/// lookups use the index, no rescanning of the document is done.
+		/// @pre The basic_json_document_index must outlive this
+		template<json_options_t PolicyFlags = json_details::default_policy_flag>
+		class basic_json_indexed_value {
+			using index_t = basic_json_document_index<PolicyFlags>;
+			index_t const *m_index = nullptr;
+			std::size_t m_pos = 0;
+
+			[[nodiscard]] json_tape_entry const &entry( ) const {
+				return m_index->tape( )[m_pos];
+			}
+
+		public:
+			using size_type = std::size_t;
+
+			basic_json_indexed_value( ) = default;
+
+			explicit basic_json_indexed_value( index_t const &idx,
+			                                   std::size_t tape_pos )
+			  : m_index( &idx )
+			  , m_pos( tape_pos ) {}
+
+			/// @brief Is this a value in the document
+			[[nodiscard]] explicit operator bool( ) const {
+				return m_index != nullptr;
+			}
+
+			/// @brief Position of the value in the tape
+			[[nodiscard]] std::size_t tape_position( ) const {
+				return m_pos;
+			}
+
+			/// @brief Get the type of JSON value
+			[[nodiscard]] JsonBaseParseTypes type( ) const {
+				if( not m_index ) {
+					return JsonBaseParseTypes::None;
+				}
+				return entry( ).type;
+			}
+
+			/// @brief Number of members/elements of a class/array, 0 otherwise. O(1)
+			[[nodiscard]] size_type size( ) const {
+				if( not m_index ) {
+					return 0;
+				}
+				return entry( ).child_count;
+			}
+
+			/// @brief The member name when the value is a class member
+			[[nodiscard]] std::optional<std::string_view> name( ) const {
+				if( not m_index or m_pos == 0 ) {
+					return { };
+				}
+				auto const &e = entry( );
+				if( e.name_size == 0 and e.name_first == 0 ) {
+					return { };
+				}
+				return m_index->name_of( e );
+			}
+
+			/// @brief The raw JSON text of this value.  Strings include their quotes
+			[[nodiscard]] std::string_view get_raw_json( ) const {
+				if( not m_index ) {
+					return { };
+				}
+				auto const &e = entry( );
+				return m_index->document( ).substr( e.value_first,
+				                                    e.value_last - e.value_first );
+			}
+
+			/// @brief A basic_json_value for this value, e.g. to parse it
+			[[nodiscard]] basic_json_value<PolicyFlags> get_json_value( ) const {
+				if( not m_index ) {
+					return { };
+				}
+				auto const doc = m_index->document( );
+				auto const *first = std::data( doc ) + entry( ).value_first;
+				auto const *last = daw::data_end( doc );
+				return basic_json_value<PolicyFlags>(
+				  BasicParsePolicy<PolicyFlags>( first, last, first, last ) );
+			}
+
+			/// @brief Parse the value as a Result.  The Result type must be supported
+			/// or mapped via a json_data_contract
+			template<typename Result>
+			[[nodiscard]] auto as( ) const {
+				return get_json_value( ).template as<Result>( );
+			}
+
+			/// @brief The nth member/element of a class/array. O(1)
+			/// @return The value or an empty basic_json_indexed_value
+			[[nodiscard]] basic_json_indexed_value
+			find_element( std::size_t index ) const {
+				if( index >= size( ) ) {
+					return { };
+				}
+				return basic_json_indexed_value(
+				  *m_index, m_index->children( )[entry( ).first_child + index] );
+			}
+
+			/// @brief The first member of a class with the name. O(log N)
+			/// @return The value or an empty basic_json_indexed_value
+			[[nodiscard]] basic_json_indexed_value
+			find_class_member( std::string_view member_name ) const {
+				if( type( ) != JsonBaseParseTypes::Class ) {
+					return { };
+				}
+				auto const &e = entry( );
+				auto const *first = std::data( m_index->sorted_members( ) ) +
+				                    static_cast<std::ptrdiff_t>( e.first_child );
+				auto const *last = first + static_cast<std::ptrdiff_t>( e.child_count );
+				auto const &tape = m_index->tape( );
+				auto const *pos = std::lower_bound(
+				  first, last, member_name,
+				  [&]( json_tape_entry::offset_t tape_pos, std::string_view n ) {
+					  return m_index->name_of( tape[tape_pos] ) < n;
+				  } );
+				if( pos == last or m_index->name_of( tape[*pos] ) != member_name ) {
+					return { };
+				}
+				return basic_json_indexed_value( *m_index, *pos );
+			}
+
+			/// @brief find a class member/array element as specified by the
+			/// json_path.  Each step is O(1) for elements and O(log N) for members
+			[[nodiscard]] basic_json_indexed_value
+			find_member( std::string_view json_path ) const {
+				auto query = json_details::json_path_query( json_path, 0 );
+				auto result = *this;
+				while( result and not query.is_terminal( ) ) {
+					if( query.is_array_index ) {
+						result = result.find_element( query.array_index );
+					} else if( query.component.contains( '\\' ) ) {
+						auto const child_count = result.size( );
+						auto found = basic_json_indexed_value( );
+						for( std::size_t n = 0; n < child_count; ++n ) {
+							auto child = result.find_element( n );
+							auto const child_name = child.name( );
+							if( child_name and
+							    query.matches_member( daw::string_view(
+							      std::data( *child_name ), std::size( *child_name ) ) ) ) {
+								found = child;
+								break;
+							}
+						}
+						result = found;
+					} else {
+						result = result.find_class_member( std::string_view(
+						  std::data( query.component ), std::size( query.component ) ) );
+					}
+					query.pop_component( );
+				}
+				return result;
+			}
+
+			[[nodiscard]] basic_json_indexed_value
+			operator[]( std::string_view json_path ) const {
+				return find_member( json_path );
+			}
+
+			[[nodiscard]] basic_json_indexed_value
+			operator[]( std::size_t index ) const {
+				return find_element( index );
+			}
+
+			/// @brief The value after this one, and its subtree, in document order.
+			/// Used to iterate over siblings without visiting children.
+			[[nodiscard]] std::size_t next_tape_position( ) const {
+				return entry( ).next;
+			}
+
+			[[nodiscard]] bool is_null( ) const {
+				return type( ) == JsonBaseParseTypes::Null;
+			}
+
+			[[nodiscard]] bool is_class( ) const {
+				return type( ) == JsonBaseParseTypes::Class;
+			}
+
+			[[nodiscard]] bool is_array( ) const {
+				return type( ) == JsonBaseParseTypes::Array;
+			}
+
+			[[nodiscard]] bool is_number( ) const {
+				return type( ) == JsonBaseParseTypes::Number;
+			}
+
+			[[nodiscard]] bool is_string( ) const {
+				return type( ) == JsonBaseParseTypes::String;
+			}
+
+			[[nodiscard]] bool is_bool( ) const {
+				return type( ) == JsonBaseParseTypes::Bool;
+			}
+		};
+
+		/// @brief A tape of all the values in a JSON document, built in one pass.
+		/// After construction, member lookups are O(log N), element lookups and
+		/// sizes are O(1) and whole subtrees can be stepped over.  Use this when
+		/// many queries are made against the same document.  Member names are
+		/// compared as they appear in the document, without unescaping.
+		/// @pre The document must outlive the index and be smaller than 4GiB
+		template<json_options_t PolicyFlags>
+		class basic_json_document_index {
+			using ParseState = TryDefaultParsePolicy<BasicParsePolicy<PolicyFlags>>;
+			using offset_t = json_tape_entry::offset_t;
+
+			std::string_view m_document{ };
+			std::vector<json_tape_entry> m_tape{ };
+			std::vector<offset_t> m_children{ };
+			std::vector<offset_t> m_sorted_members{ };
+
+			[[nodiscard]] offset_t offset_of( char const *ptr ) const {
+				return static_cast<offset_t>( ptr - std::data( m_document ) );
+			}
+
+			void build_tape( ) {
+				auto parse_state = ParseState( std::data( m_document ),
+				                               daw::data_end( m_document ) );
+				parse_state.trim_left_checked( );
+				if( not parse_state.has_more( ) ) {
+					return;
+				}
+				// Open classes/arrays as tape indices
+				auto stack = std::vector<offset_t>( );
+				do {
+					auto e = json_tape_entry{ };
+					if( not stack.empty( ) ) {
+						auto &parent = m_tape[stack.back( )];
+						++parent.child_count;
+						if( parent.type == JsonBaseParseTypes::Class ) {
+							daw_json_assert_weak( parse_state.is_quotes_checked( ),
+							                      ErrorReason::MissingMemberName,
+							                      parse_state );
+							auto const member_name = json_details::parse_name( parse_state );
+							e.name_first = offset_of( std::data( member_name ) );
+							e.name_size = static_cast<offset_t>( std::size( member_name ) );
+						}
+					}
+					daw_json_assert_weak( parse_state.has_more( ),
+					                      ErrorReason::UnexpectedEndOfData, parse_state );
+					e.value_first = offset_of( parse_state.first );
+					switch( parse_state.front( ) ) {
+					case '{':
+						e.type = JsonBaseParseTypes::Class;
+						break;
+					case '[':
+						e.type = JsonBaseParseTypes::Array;
+						break;
+					case '"':
+						e.type = JsonBaseParseTypes::String;
+						break;
+					case 't':
+					case 'f':
+						e.type = JsonBaseParseTypes::Bool;
+						break;
+					case 'n':
+						e.type = JsonBaseParseTypes::Null;
+						break;
+					default:
+						e.type = JsonBaseParseTypes::Number;
+						break;
+					}
+					auto const tape_pos = static_cast<offset_t>( std::size( m_tape ) );
+					if( e.type == JsonBaseParseTypes::Class or
+					    e.type == JsonBaseParseTypes::Array ) {
+						m_tape.push_back( e );
+						stack.push_back( tape_pos );
+						parse_state.remove_prefix( );
+						parse_state.trim_left_checked( );
+					} else {
+						(void)json_details::skip_value( parse_state );
+						e.value_last = offset_of( parse_state.first );
+						e.next = tape_pos + 1;
+						m_tape.push_back( e );
+						parse_state.move_next_member_or_end( );
+					}
+					// Close any finished classes/arrays
+					while( not stack.empty( ) and parse_state.has_more( ) and
+					       ( parse_state.front( ) == '}' or
+					         parse_state.front( ) == ']' ) ) {
+						auto &parent = m_tape[stack.back( )];
+						daw_json_assert_weak(
+						  ( parse_state.front( ) == '}' ) ==
+						    ( parent.type == JsonBaseParseTypes::Class ),
+						  ErrorReason::InvalidBracketing, parse_state );
+						parse_state.remove_prefix( );
+						parent.value_last = offset_of( parse_state.first );
+						parent.next = static_cast<offset_t>( std::size( m_tape ) );
+						stack.pop_back( );
+						parse_state.move_next_member_or_end( );
+					}
+				} while( not stack.empty( ) );
+			}
+
+			void build_child_tables( ) {
+				m_children.reserve( std::size( m_tape ) );
+				for( auto &e : m_tape ) {
+					if( e.type != JsonBaseParseTypes::Class and
+					    e.type != JsonBaseParseTypes::Array ) {
+						continue;
+					}
+					e.first_child = static_cast<offset_t>( std::size( m_children ) );
+					auto const tape_pos = static_cast<offset_t>( &e - std::data( m_tape ) );
+					for( offset_t child = tape_pos + 1; child < e.next;
+					     child = m_tape[child].next ) {
+						m_children.push_back( child );
+					}
+				}
+				m_sorted_members = m_children;
+				for( auto const &e : m_tape ) {
+					if( e.type != JsonBaseParseTypes::Class ) {
+						continue;
+					}
+					auto first = std::begin( m_sorted_members ) +
+					             static_cast<std::ptrdiff_t>( e.first_child );
+					// Stable so that the first of duplicate names is found
+					std::stable_sort( first,
+					                  first + static_cast<std::ptrdiff_t>( e.child_count ),
+					                  [&]( offset_t lhs, offset_t rhs ) {
+						                  return name_of( m_tape[lhs] ) <
+						                         name_of( m_tape[rhs] );
+					                  } );
+				}
+			}
+
+		public:
+			using value_type = basic_json_indexed_value<PolicyFlags>;
+
+			basic_json_document_index( ) = default;
+
+			/// @brief Index the document
+			/// @param json_doc JSON document to index.  It is not copied and must
+			/// outlive the index
+			explicit basic_json_document_index( std::string_view json_doc )
+			  : m_document( json_doc ) {
+				daw_json_ensure( std::data( json_doc ) != nullptr,
+				                 ErrorReason::EmptyJSONDocument );
+				daw_json_ensure( std::size( json_doc ) <
+				                   ( std::numeric_limits<offset_t>::max )( ),
+				                 ErrorReason::NumberOutOfRange );
+				build_tape( );
+				build_child_tables( );
+			}
+
+			/// @brief The root value of the document
+			[[nodiscard]] value_type root( ) const {
+				if( m_tape.empty( ) ) {
+					return { };
+				}
+				return value_type( *this, 0 );
+			}
+
+			/// @brief find a class member/array element from the root as specified
+			/// by the json_path
+			[[nodiscard]] value_type find_member( std::string_view json_path ) const {
+				return root( ).find_member( json_path );
+			}
+
+			[[nodiscard]] value_type operator[]( std::string_view json_path ) const {
+				return find_member( json_path );
+			}
+
+			[[nodiscard]] std::string_view document( ) const {
+				return m_document;
+			}
+
+			/// @brief The tape, with the values in document order
+			[[nodiscard]] std::vector<json_tape_entry> const &tape( ) const {
+				return m_tape;
+			}
+
+			/// @brief Tape positions of each class/array's children, in document
+			/// order starting at json_tape_entry::first_child
+			[[nodiscard]] std::vector<offset_t> const &children( ) const {
+				return m_children;
+			}
+
+			/// @brief Like children( ), but class members are sorted by name
+			[[nodiscard]] std::vector<offset_t> const &sorted_members( ) const {
+				return m_sorted_members;
+			}
+
+			[[nodiscard]] std::string_view name_of( json_tape_entry const &e ) const {
+				return m_document.substr( e.name_first, e.name_size );
+			}
+		};
+
+		basic_json_document_index( std::string_view )
+		  -> basic_json_document_index<>;
+
+		using json_document_index = basic_json_document_index<>;
+		using json_indexed_value = basic_json_indexed_value<>;
+	} // namespace DAW_JSON_VER
+} // namespace daw::json
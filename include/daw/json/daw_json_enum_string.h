@@ -0,0 +1,293 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#pragma once
+
+#include "impl/version.h"
+
+#include "daw_json_link_types.h"
+#include "impl/daw_json_assert.h"
+
+#include <daw/daw_attributes.h>
+#include <daw/daw_likely.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <string_view>
+#include <type_traits>
+
+namespace daw::json {
+	inline namespace DAW_JSON_VER {
+		/// @brief An enumerator and the string it is encoded as in JSON
+		template<typename E>
+		struct json_enum_name {
+			E value;
+			std::string_view name;
+		};
+
+		/// @brief Specialize to map the enumerators of E to strings.  The
+		/// specialization needs a static constexpr array of json_enum_name<E>
+		/// named values, e.g.
+		/// static constexpr json_enum_name<Colours> values[] = {
+		///   { Colours::red, "red" }, { Colours::green, "green" } };
+		/// Names and values must be unique.
+		template<typename E>
+		struct json_enum_names;
+
+		namespace json_details {
+			DAW_ATTRIB_INLINE constexpr std::uint64_t
+			enum_hash_mix( std::uint64_t h ) {
+				h ^= h >> 30U;
+				h *= 0xBF58'476D'1CE4'E5B9ULL;
+				h ^= h >> 27U;
+				h *= 0x94D0'49BB'1331'11EBULL;
+				h ^= h >> 31U;
+				return h;
+			}
+
+			DAW_ATTRIB_INLINE constexpr std::uint64_t
+			enum_name_hash( std::string_view name, std::uint64_t seed ) {
+				auto h = 0xCBF2'9CE4'8422'2325ULL ^ seed;
+				for( char c : name ) {
+					h ^= static_cast<unsigned char>( c );
+					h *= 0x0000'0100'0000'01B3ULL;
+				}
+				return enum_hash_mix( h );
+			}
+
+			DAW_ATTRIB_INLINE constexpr std::uint64_t
+			enum_value_hash( std::uint64_t value, std::uint64_t seed ) {
+				return enum_hash_mix( value ^ ( seed * 0x9E37'79B9'7F4A'7C15ULL ) );
+			}
+
+			constexpr std::size_t enum_hash_bucket_count( std::size_t n ) {
+				std::size_t result = 1;
+				while( result < n ) {
+					result *= 2;
+				}
+				return result;
+			}
+
+			/***
+			 * A minimal perfect hash over N keys using hash and displace.  The keys
+			 * are split into buckets by their hash, and each bucket has a
+			 * displacement that places all of its keys in empty slots.  A lookup is
+			 * a hash, two table reads and one comparison with the candidate key.
+			 * @tparam N Number of keys
+			 */
+			template<std::size_t N>
+			struct enum_perfect_hash_t {
+				static constexpr std::size_t bucket_count = enum_hash_bucket_count( N );
+				static constexpr std::size_t slot_count = bucket_count * 2;
+
+				std::uint64_t seed = 0;
+				std::uint32_t displacements[bucket_count] = { };
+				/// Index of the key in each slot, N when the slot is empty
+				std::uint32_t slots[slot_count] = { };
+				bool is_valid = false;
+
+				[[nodiscard]] static constexpr std::size_t
+				bucket_of( std::uint64_t h ) {
+					return static_cast<std::size_t>( h & ( bucket_count - 1 ) );
+				}
+
+				[[nodiscard]] static constexpr std::size_t
+				slot_of( std::uint64_t h, std::uint64_t displacement ) {
+					auto const h1 = h >> 32U;
+					auto const h2 = ( h >> 16U ) | 1U;
+					return static_cast<std::size_t>( ( h1 + displacement * h2 ) &
+					                                 ( slot_count - 1 ) );
+				}
+
+				/// @brief Find the only key that can have the hash h
+				/// @return The index of the candidate key, or N when there is none.
+				/// The candidate must still be compared with the key searched for
+				[[nodiscard]] DAW_ATTRIB_INLINE constexpr std::size_t
+				find( std::uint64_t h ) const {
+					return slots[slot_of( h, displacements[bucket_of( h )] )];
+				}
+			};
+
+			/// @brief Build a perfect hash over N keys
+			/// @param hash_key Callable returning the hash of the key at an index
+			/// for a seed
+			/// @return The table, is_valid is false when keys have equal hashes for
+			/// every seed tried, e.g. when keys are duplicated
+			template<std::size_t N, typename HashKey>
+			constexpr enum_perfect_hash_t<N>
+			make_enum_perfect_hash( HashKey const &hash_key ) {
+				using table_t = enum_perfect_hash_t<N>;
+				constexpr std::uint64_t max_seeds = 32;
+				constexpr std::uint64_t max_displacement = table_t::slot_count * 4;
+				constexpr auto empty_slot = static_cast<std::uint32_t>( N );
+
+				for( std::uint64_t seed = 0; seed < max_seeds; ++seed ) {
+					auto result = table_t{ };
+					result.seed = seed;
+					for( auto &slot : result.slots ) {
+						slot = empty_slot;
+					}
+					auto hashes = std::array<std::uint64_t, N>{ };
+					// Sort the keys by bucket
+					auto bucket_first = std::array<std::size_t, table_t::bucket_count + 1>{ };
+					for( std::size_t n = 0; n < N; ++n ) {
+						hashes[n] = hash_key( n, seed );
+						++bucket_first[table_t::bucket_of( hashes[n] ) + 1];
+					}
+					std::size_t max_bucket_size = 0;
+					for( std::size_t b = 0; b < table_t::bucket_count; ++b ) {
+						if( bucket_first[b + 1] > max_bucket_size ) {
+							max_bucket_size = bucket_first[b + 1];
+						}
+						bucket_first[b + 1] += bucket_first[b];
+					}
+					auto keys = std::array<std::uint32_t, N>{ };
+					auto bucket_last = std::array<std::size_t, table_t::bucket_count>{ };
+					for( std::size_t b = 0; b < table_t::bucket_count; ++b ) {
+						bucket_last[b] = bucket_first[b];
+					}
+					for( std::size_t n = 0; n < N; ++n ) {
+						keys[bucket_last[table_t::bucket_of( hashes[n] )]++] =
+						  static_cast<std::uint32_t>( n );
+					}
+
+					// Place the largest buckets first, while the table is emptiest
+					bool is_placed = true;
+					for( std::size_t sz = max_bucket_size; sz > 0 and is_placed; --sz ) {
+						for( std::size_t b = 0; b < table_t::bucket_count and is_placed;
+						     ++b ) {
+							if( bucket_last[b] - bucket_first[b] != sz ) {
+								continue;
+							}
+							is_placed = false;
+							for( std::uint64_t d = 0; d < max_displacement and not is_placed;
+							     ++d ) {
+								std::size_t k = bucket_first[b];
+								for( ; k < bucket_last[b]; ++k ) {
+									auto const s = table_t::slot_of( hashes[keys[k]], d );
+									if( result.slots[s] != empty_slot ) {
+										break;
+									}
+									result.slots[s] = keys[k];
+								}
+								if( k == bucket_last[b] ) {
+									result.displacements[b] = static_cast<std::uint32_t>( d );
+									is_placed = true;
+								} else {
+									// Undo the partial placement
+									while( k > bucket_first[b] ) {
+										--k;
+										result.slots[table_t::slot_of( hashes[keys[k]], d )] =
+										  empty_slot;
+									}
+								}
+							}
+						}
+					}
+					if( is_placed ) {
+						result.is_valid = true;
+						return result;
+					}
+				}
+				return table_t{ };
+			}
+
+			template<typename E>
+			struct enum_name_hasher {
+				constexpr std::uint64_t operator( )( std::size_t idx,
+				                                     std::uint64_t seed ) const {
+					return enum_name_hash( json_enum_names<E>::values[idx].name, seed );
+				}
+			};
+
+			template<typename E>
+			DAW_ATTRIB_INLINE constexpr std::uint64_t enum_to_uint64( E value ) {
+				return static_cast<std::uint64_t>(
+				  static_cast<std::underlying_type_t<E>>( value ) );
+			}
+
+			template<typename E>
+			struct enum_value_hasher {
+				constexpr std::uint64_t operator( )( std::size_t idx,
+				                                     std::uint64_t seed ) const {
+					return enum_value_hash(
+					  enum_to_uint64( json_enum_names<E>::values[idx].value ), seed );
+				}
+			};
+		} // namespace json_details
+
+		/***
+		 * Converts between E and the strings in json_enum_names<E>.  Both
+		 * directions use a perfect hash built at compile time, so they are O(1)
+		 * and do not allocate.  Usable as both converters of a json_custom.
+		 * @tparam E An enum with a specialization of json_enum_names
+		 */
+		template<typename E>
+		struct enum_string_converter {
+			static_assert( std::is_enum_v<E>, "Expected an enum type" );
+
+			static constexpr std::size_t size =
+			  std::size( json_enum_names<E>::values );
+
+			static constexpr auto name_table =
+			  json_details::make_enum_perfect_hash<size>(
+			    json_details::enum_name_hasher<E>{ } );
+			static_assert( name_table.is_valid,
+			               "The names in json_enum_names must be unique" );
+
+			static constexpr auto value_table =
+			  json_details::make_enum_perfect_hash<size>(
+			    json_details::enum_value_hasher<E>{ } );
+			static_assert( value_table.is_valid,
+			               "The values in json_enum_names must be unique" );
+
+			/// @brief Parse the enumerator named name
+			/// @throws json_exception when name is not in json_enum_names
+			[[nodiscard]] constexpr E operator( )( std::string_view name ) const {
+				auto const idx = name_table.find(
+				  json_details::enum_name_hash( name, name_table.seed ) );
+				if( DAW_UNLIKELY( idx >= size or
+				                  json_enum_names<E>::values[idx].name != name ) ) {
+					daw_json_error( ErrorReason::UnknownEnumValue );
+				}
+				return json_enum_names<E>::values[idx].value;
+			}
+
+			/// @brief The name of value.  It is unquoted and the quotes are added
+			/// when serializing
+			/// @throws json_exception when value is not in json_enum_names
+			[[nodiscard]] constexpr std::string_view operator( )( E value ) const {
+				auto const idx = value_table.find( json_details::enum_value_hash(
+				  json_details::enum_to_uint64( value ), value_table.seed ) );
+				if( DAW_UNLIKELY( idx >= size or
+				                  json_enum_names<E>::values[idx].value != value ) ) {
+					daw_json_error( ErrorReason::UnknownEnumValue );
+				}
+				return json_enum_names<E>::values[idx].name;
+			}
+		};
+
+		/// @brief Map an enum to a JSON string using json_enum_names<E>
+		/// @tparam Name Name of the JSON member
+		/// @tparam E Enum type being mapped
+		template<JSONNAMETYPE Name, typename E,
+		         json_options_t Options = json_custom_opts_def>
+		using json_enum_string = json_custom<Name, E, enum_string_converter<E>,
+		                                     enum_string_converter<E>, Options>;
+
+		/// @brief Map an enum to a JSON string using json_enum_names<E>.  Used
+		/// where names are not needed, e.g. array elements
+		/// @tparam E Enum type being mapped
+		template<typename E, json_options_t Options = json_custom_opts_def>
+		using json_enum_string_no_name =
+		  json_custom_no_name<E, enum_string_converter<E>,
+		                      enum_string_converter<E>, Options>;
+	} // namespace DAW_JSON_VER
+} // namespace daw::json
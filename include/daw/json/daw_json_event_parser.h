@@ -17,6 +17,7 @@
 #include <daw/daw_move.h>
 #include <daw/daw_string_view.h>
 
+#include <array>
 #include <cstddef>
 #include <daw/stdinc/declval.h>
 #include <daw/stdinc/move_fwd_exch.h>
@@ -314,6 +315,74 @@ namespace daw::json {
 			}
 		};
 
+		/// @brief A stack policy for json_event_parser that does not allocate.  At
+		/// most MaxDepth classes/arrays can be open at once, more is an error of
+		/// ErrorReason::MaxNestingDepthExceeded.
+		/// @tparam StackValue The stack element type
+		/// @tparam MaxDepth The maximum nesting depth of classes/arrays
+		template<typename StackValue, std::size_t MaxDepth>
+		class FixedJsonEventParserStackPolicy {
+			static_assert( MaxDepth > 0, "A nesting depth of at least 1 is needed" );
+			std::array<StackValue, MaxDepth> m_stack;
+			std::size_t m_size = 0;
+
+		public:
+			using value_type = StackValue;
+			using reference = StackValue &;
+			using size_type = std::size_t;
+			using difference_type = std::ptrdiff_t;
+
+			static constexpr size_type max_depth = MaxDepth;
+
+			FixedJsonEventParserStackPolicy( ) = default;
+
+			CPP20CONSTEXPR void push_back( value_type &&v ) {
+				daw_json_ensure( m_size < MaxDepth,
+				                 ErrorReason::MaxNestingDepthExceeded );
+				m_stack[m_size] = std::move( v );
+				++m_size;
+			}
+
+			[[nodiscard]] CPP20CONSTEXPR reference back( ) {
+				return m_stack[m_size - 1];
+			}
+
+			CPP20CONSTEXPR void clear( ) {
+				m_size = 0;
+			}
+
+			CPP20CONSTEXPR void pop_back( ) {
+				--m_size;
+			}
+
+			[[nodiscard]] CPP20CONSTEXPR bool empty( ) const {
+				return m_size == 0;
+			}
+
+			[[nodiscard]] CPP20CONSTEXPR size_type size( ) const {
+				return m_size;
+			}
+		};
+
+		/// @brief Select a FixedJsonEventParserStackPolicy as the
+		/// StackContainerPolicy of json_event_parser, e.g.
+		/// json_event_parser<fixed_event_parser_stack<32>>( json_doc, handler )
+		/// @tparam MaxDepth The maximum nesting depth of classes/arrays
+		template<std::size_t MaxDepth = 64>
+		struct fixed_event_parser_stack {
+			static constexpr std::size_t max_depth = MaxDepth;
+		};
+
+		namespace json_details {
+			template<typename>
+			inline constexpr bool is_fixed_event_parser_stack_v = false;
+
+			template<std::size_t MaxDepth>
+			inline constexpr bool
+			  is_fixed_event_parser_stack_v<fixed_event_parser_stack<MaxDepth>> =
+			    true;
+		} // namespace json_details
+
 		template<typename StackContainerPolicy = use_default, json_options_t P,
 		         typename A, typename Handler, auto... ParseFlags>
 		constexpr void json_event_parser( basic_json_value<P, A> bjv,
@@ -333,6 +402,10 @@ namespace daw::json {
 			auto parent_stack = [] {
 				if constexpr( std::is_same_v<StackContainerPolicy, use_default> ) {
 					return DefaultJsonEventParserStackPolicy<stack_value_t>{ };
+				} else if constexpr( json_details::is_fixed_event_parser_stack_v<
+				                       StackContainerPolicy> ) {
+					return FixedJsonEventParserStackPolicy<
+					  stack_value_t, StackContainerPolicy::max_depth>{ };
 				} else {
 					return StackContainerPolicy{ };
 				}
@@ -87,7 +87,13 @@ namespace daw::json {
 			ExpectedTokenNotFound,
 			UnexpectedJSONVariantType,
 			TrailingComma,
-			AttemptToCallOpStarOnConstIterator
+			AttemptToCallOpStarOnConstIterator,
+			MaxNestingDepthExceeded,
+			UnknownEnumValue,
+			StringCapacityExceeded,
+			InvalidJSONLinesIndex,
+			InputError,
+			InvalidPMROptions
 		};
 
 		constexpr std::string_view reason_message( ErrorReason er ) {
@@ -189,6 +195,18 @@ namespace daw::json {
 				return "Trailing comma"sv;
 			case ErrorReason::AttemptToCallOpStarOnConstIterator:
 				return "Use of operator*( ) on const iterator";
+			case ErrorReason::MaxNestingDepthExceeded:
+				return "Maximum nesting depth of classes/arrays exceeded"sv;
+			case ErrorReason::UnknownEnumValue:
+				return "Value is not a mapped enumerator"sv;
+			case ErrorReason::StringCapacityExceeded:
+				return "String is longer than the capacity of its fixed capacity type"sv;
+			case ErrorReason::InvalidJSONLinesIndex:
+				return "JSON Lines index is corrupt or does not match the document"sv;
+			case ErrorReason::InputError:
+				return "General error while reading input"sv;
+			case ErrorReason::InvalidPMROptions:
+				return "json_pmr_options has a null upstream or a negative buffer_ratio"sv;
 			}
 			DAW_UNREACHABLE( );
 		}
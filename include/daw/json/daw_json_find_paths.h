@@ -0,0 +1,420 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#pragma once
+
+#include "impl/version.h"
+
+#include "daw_from_json.h"
+#include "impl/daw_json_assert.h"
+#include "impl/daw_json_parse_name.h"
+#include "impl/daw_json_skip.h"
+#include "impl/daw_json_value.h"
+
+#include <daw/daw_data_end.h>
+#include <daw/daw_move.h>
+#include <daw/daw_string_view.h>
+
+#include <array>
+#include <cstddef>
+#include <string_view>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace daw::json {
+	inline namespace DAW_JSON_VER {
+		namespace json_details {
+			/// @brief The state of one JSON Path in a batched query.  component is
+			/// the part of the path to match at the current depth, and remaining is
+			/// what is left after it.
+			struct json_path_query {
+				daw::string_view component{ };
+				daw::string_view remaining{ };
+				std::size_t array_index = 0;
+				std::size_t result_index = 0;
+				bool is_array_index = false;
+
+				constexpr json_path_query( ) = default;
+
+				explicit constexpr json_path_query( daw::string_view path,
+				                                    std::size_t result_idx )
+				  : remaining( path )
+				  , result_index( result_idx ) {
+					pop_component( );
+				}
+
+				/// @brief The whole path has been matched and the current value is the
+				/// result
+				[[nodiscard]] constexpr bool is_terminal( ) const {
+					return component.empty( );
+				}
+
+				/// @brief Move to the next part of the path.  Empty parts, like the
+				/// leading part of "[1]", are skipped
+				constexpr void pop_component( ) {
+					auto pop_result = pop_json_path( remaining );
+					while( pop_result.current.empty( ) and not remaining.empty( ) ) {
+						pop_result = pop_json_path( remaining );
+					}
+					component = pop_result.current;
+					is_array_index = pop_result.found_char == ']';
+					if( is_array_index and not component.empty( ) ) {
+						array_index = parse_unsigned_int<std::size_t>(
+						  std::data( component ), daw::data_end( component ) );
+					}
+				}
+
+				[[nodiscard]] constexpr bool
+				matches_member( daw::string_view name ) const {
+					return not is_array_index and json_path_compare( component, name );
+				}
+
+				[[nodiscard]] constexpr bool
+				matches_element( std::size_t index ) const {
+					return is_array_index and array_index == index;
+				}
+			};
+
+			/// @brief Move the queries satisfying pred to the front of [first, last)
+			/// @return The end of the matching queries
+			template<typename Predicate>
+			[[nodiscard]] constexpr json_path_query *
+			partition_path_queries( json_path_query *first, json_path_query *last,
+			                        Predicate pred ) {
+				auto *mid = first;
+				for( ; first != last; ++first ) {
+					if( pred( *first ) ) {
+						if( mid != first ) {
+							auto tmp = *mid;
+							*mid = *first;
+							*first = tmp;
+						}
+						++mid;
+					}
+				}
+				return mid;
+			}
+
+			template<typename ParseState, typename JsonValue>
+			constexpr void find_json_paths_in_value( ParseState &parse_state,
+			                                         json_path_query *first,
+			                                         json_path_query *last,
+			                                         JsonValue *results,
+			                                         bool must_consume );
+
+			/// @brief [first, last) matched the value at parse_state.  Record those
+			/// that are complete and continue into the value with the others.
+			template<typename ParseState, typename JsonValue>
+			constexpr void
+			descend_json_paths( ParseState &parse_state, json_path_query *first,
+			                    json_path_query *last, JsonValue *results,
+			                    bool must_consume ) {
+				for( auto *it = first; it != last; ++it ) {
+					it->pop_component( );
+				}
+				auto *const terminal_last = partition_path_queries(
+				  first, last, []( json_path_query const &q ) {
+					  return q.is_terminal( );
+				  } );
+				for( auto *it = first; it != terminal_last; ++it ) {
+					results[it->result_index] = JsonValue( ParseState(
+					  parse_state.first, parse_state.last, parse_state.first,
+					  parse_state.last, parse_state.get_allocator( ) ) );
+				}
+				find_json_paths_in_value( parse_state, terminal_last, last, results,
+				                          must_consume );
+			}
+
+			/// @brief Resolve the non-terminal queries in [first, last) against the
+			/// children of the value at parse_state.  Each child is visited at most
+			/// once; children no query needs are skipped.  When must_consume is
+			/// false, the search stops as soon as all queries are resolved and
+			/// parse_state is left unspecified.
+			template<typename ParseState, typename JsonValue>
+			constexpr void find_json_paths_in_value( ParseState &parse_state,
+			                                         json_path_query *first,
+			                                         json_path_query *last,
+			                                         JsonValue *results,
+			                                         bool must_consume ) {
+				if( first == last ) {
+					if( must_consume ) {
+						(void)skip_value( parse_state );
+					}
+					return;
+				}
+				daw_json_assert_weak( parse_state.has_more( ),
+				                      ErrorReason::UnexpectedEndOfData, parse_state );
+				switch( parse_state.front( ) ) {
+				case '{': {
+					parse_state.remove_prefix( );
+					parse_state.trim_left_checked( );
+					while( parse_state.is_quotes_checked( ) ) {
+						auto const name = parse_name( parse_state );
+						auto *const mid = partition_path_queries(
+						  first, last, [&]( json_path_query const &q ) {
+							  return q.matches_member( name );
+						  } );
+						if( mid == first ) {
+							(void)skip_value( parse_state );
+						} else {
+							descend_json_paths( parse_state, first, mid, results,
+							                    must_consume or mid != last );
+							first = mid;
+							if( first == last and not must_consume ) {
+								return;
+							}
+						}
+						parse_state.move_next_member_or_end( );
+					}
+					daw_json_assert_weak( parse_state.is_closing_brace_checked( ),
+					                      ErrorReason::InvalidBracketing, parse_state );
+					parse_state.remove_prefix( );
+					parse_state.trim_left( );
+					return;
+				}
+				case '[': {
+					parse_state.remove_prefix( );
+					parse_state.trim_left_checked( );
+					std::size_t index = 0;
+					while( parse_state.has_more( ) and parse_state.front( ) != ']' ) {
+						auto *const mid = partition_path_queries(
+						  first, last, [&]( json_path_query const &q ) {
+							  return q.matches_element( index );
+						  } );
+						if( mid == first ) {
+							(void)skip_value( parse_state );
+						} else {
+							descend_json_paths( parse_state, first, mid, results,
+							                    must_consume or mid != last );
+							first = mid;
+							if( first == last and not must_consume ) {
+								return;
+							}
+						}
+						++index;
+						parse_state.move_next_member_or_end( );
+					}
+					daw_json_assert_weak( parse_state.has_more( ) and
+					                        parse_state.front( ) == ']',
+					                      ErrorReason::InvalidBracketing, parse_state );
+					parse_state.remove_prefix( );
+					parse_state.trim_left( );
+					return;
+				}
+				default:
+					// Paths that continue into a literal cannot be found
+					if( must_consume ) {
+						(void)skip_value( parse_state );
+					}
+					return;
+				}
+			}
+
+			/// @brief Resolve all queries against the document in one pass.
+			/// results[q.result_index] is left default constructed for paths that
+			/// are not found.
+			template<typename ParseState, typename JsonValue>
+			constexpr void find_json_paths_impl( ParseState parse_state,
+			                                     json_path_query *first,
+			                                     json_path_query *last,
+			                                     JsonValue *results ) {
+				parse_state.trim_left_checked( );
+				if( not parse_state.has_more( ) ) {
+					return;
+				}
+				auto *const terminal_last = partition_path_queries(
+				  first, last, []( json_path_query const &q ) {
+					  return q.is_terminal( );
+				  } );
+				for( auto *it = first; it != terminal_last; ++it ) {
+					results[it->result_index] = JsonValue( parse_state );
+				}
+				find_json_paths_in_value( parse_state, terminal_last, last, results,
+				                          false );
+			}
+
+			template<json_options_t PolicyFlags, typename String>
+			[[nodiscard]] constexpr auto
+			make_find_paths_state( String const &json_doc ) {
+				static_assert(
+				  json_details::is_string_view_like_v<String>,
+				  "String type must have a be a contiguous range of Characters" );
+				daw_json_ensure( std::data( json_doc ) != nullptr,
+				                 ErrorReason::EmptyJSONDocument );
+				daw_json_ensure( std::size( json_doc ) != 0,
+				                 ErrorReason::EmptyJSONDocument );
+				using ParseState =
+				  TryDefaultParsePolicy<BasicParsePolicy<PolicyFlags>>;
+				auto first = std::data( json_doc );
+				auto last = daw::data_end( json_doc );
+				if( last[-1] == 0 ) {
+					--last;
+				}
+				return ParseState( first, last );
+			}
+
+			template<typename JsonMember, json_options_t PolicyFlags,
+			         typename Allocator>
+			[[nodiscard]] constexpr auto
+			parse_found_path( basic_json_value<PolicyFlags, Allocator> const &jv ) {
+				using json_member = json_deduced_type<JsonMember>;
+				static_assert(
+				  has_unnamed_default_type_mapping_v<JsonMember>,
+				  "Missing specialization of daw::json::json_data_contract for class "
+				  "mapping or specialization of daw::json::json_link_basic_type_map" );
+				if constexpr( is_json_nullable_v<json_member> ) {
+					if( not jv ) {
+						return construct_nullable_empty<
+						  json_constructor_t<json_member>>( );
+					}
+				} else {
+					daw_json_ensure( jv, ErrorReason::JSONPathNotFound );
+				}
+				auto parse_state = jv.get_raw_state( );
+				return parse_value<json_member, false, json_member::expected_type>(
+				  parse_state );
+			}
+
+			template<typename... JsonMembers, typename JsonValue,
+			         std::size_t... Is>
+			[[nodiscard]] constexpr auto
+			parse_found_paths( JsonValue const *values,
+			                   std::index_sequence<Is...> ) {
+				return std::make_tuple( parse_found_path<JsonMembers>( values[Is] )... );
+			}
+		} // namespace json_details
+
+		/// @brief Find the values at several JSON Paths in a single pass over the
+		/// document.  Members that no path needs are skipped, and the search stops
+		/// once every path is resolved.  Paths use the same syntax as from_json,
+		/// e.g. "member.sub_member[5]"; when a name is duplicated the first one is
+		/// used.
+		/// @tparam String Type of json document
+		/// @tparam N Number of paths
+		/// @tparam PolicyFlags Parser Policy flags.  See parser_policies.md
+		/// @param json_doc The json document to search
+		/// @param json_paths The JSON Paths to find
+		/// @return A basic_json_value for each path, in the same order as
+		/// json_paths.  Paths that are not found give an empty basic_json_value
+		template<typename String, std::size_t N, auto... PolicyFlags>
+		[[nodiscard]] constexpr auto
+		find_json_paths( String &&json_doc,
+		                 std::string_view const ( &json_paths )[N],
+		                 options::parse_flags_t<PolicyFlags...> ) {
+			constexpr auto flags = options::parse_flags_t<PolicyFlags...>::value;
+			auto results = std::array<basic_json_value<flags>, N>{ };
+			auto queries = std::array<json_details::json_path_query, N>{ };
+			for( std::size_t n = 0; n < N; ++n ) {
+				queries[n] = json_details::json_path_query( json_paths[n], n );
+			}
+			json_details::find_json_paths_impl(
+			  json_details::make_find_paths_state<flags>( json_doc ),
+			  std::data( queries ), daw::data_end( queries ), std::data( results ) );
+			return results;
+		}
+
+		/// @brief Find the values at several JSON Paths in a single pass over the
+		/// document.  See the find_json_paths overload taking parse flags.
+		/// @param json_doc The json document to search
+		/// @param json_paths The JSON Paths to find
+		/// @return A json_value for each path, in the same order as json_paths.
+		/// Paths that are not found give an empty json_value
+		template<typename String, std::size_t N>
+		[[nodiscard]] constexpr auto
+		find_json_paths( String &&json_doc,
+		                 std::string_view const ( &json_paths )[N] ) {
+			return find_json_paths( DAW_FWD( json_doc ), json_paths,
+			                        options::parse_flags<> );
+		}
+
+		/// @brief Find the values at several JSON Paths, known at runtime, in a
+		/// single pass over the document.  See the find_json_paths overload taking
+		/// an array of paths.
+		/// @tparam String Type of json document
+		/// @tparam Paths A contiguous range of std::string_view's, e.g.
+		/// std::vector<std::string_view>
+		/// @tparam PolicyFlags Parser Policy flags.  See parser_policies.md
+		/// @param json_doc The json document to search
+		/// @param json_paths The JSON Paths to find
+		/// @return A std::vector with a basic_json_value for each path, in the same
+		/// order as json_paths.  Paths that are not found give an empty
+		/// basic_json_value
+		template<typename String, typename Paths, auto... PolicyFlags>
+		[[nodiscard]] auto
+		find_json_paths( String &&json_doc, Paths const &json_paths,
+		                 options::parse_flags_t<PolicyFlags...> ) {
+			constexpr auto flags = options::parse_flags_t<PolicyFlags...>::value;
+			auto const path_count = std::size( json_paths );
+			auto results = std::vector<basic_json_value<flags>>( path_count );
+			auto queries = std::vector<json_details::json_path_query>( );
+			queries.reserve( path_count );
+			for( std::size_t n = 0; n < path_count; ++n ) {
+				queries.emplace_back( std::string_view( std::data( json_paths )[n] ),
+				                      n );
+			}
+			json_details::find_json_paths_impl(
+			  json_details::make_find_paths_state<flags>( json_doc ),
+			  std::data( queries ), daw::data_end( queries ), std::data( results ) );
+			return results;
+		}
+
+		/// @brief Find the values at several JSON Paths, known at runtime, in a
+		/// single pass over the document.
+		/// @param json_doc The json document to search
+		/// @param json_paths The JSON Paths to find
+		/// @return A std::vector with a json_value for each path, in the same order
+		/// as json_paths.  Paths that are not found give an empty json_value
+		template<typename String, typename Paths>
+		[[nodiscard]] auto find_json_paths( String &&json_doc,
+		                                    Paths const &json_paths ) {
+			return find_json_paths( DAW_FWD( json_doc ), json_paths,
+			                        options::parse_flags<> );
+		}
+
+		/// @brief Parse several members, each at its own JSON Path, with a single
+		/// pass to locate them.  This is like calling from_json with a member path
+		/// once per member, without rescanning the document each time.
+		/// @tparam JsonMembers The types of the items being parsed
+		/// @tparam String Type of json document
+		/// @tparam PolicyFlags Parser Policy flags.  See parser_policies.md
+		/// @param json_doc The json document with the members
+		/// @param json_paths The JSON Path of each member
+		/// @return A std::tuple with the parsed values
+		/// @throws daw::json::json_exception when a path to a non-nullable member
+		/// is not found
+		template<typename... JsonMembers, typename String, auto... PolicyFlags>
+		[[nodiscard]] constexpr auto from_json_paths(
+		  String &&json_doc,
+		  std::string_view const ( &json_paths )[sizeof...( JsonMembers )],
+		  options::parse_flags_t<PolicyFlags...> flags ) {
+			auto const values =
+			  find_json_paths( DAW_FWD( json_doc ), json_paths, flags );
+			return json_details::parse_found_paths<JsonMembers...>(
+			  std::data( values ),
+			  std::make_index_sequence<sizeof...( JsonMembers )>{ } );
+		}
+
+		/// @brief Parse several members, each at its own JSON Path, with a single
+		/// pass to locate them.
+		/// @tparam JsonMembers The types of the items being parsed
+		/// @tparam String Type of json document
+		/// @param json_doc The json document with the members
+		/// @param json_paths The JSON Path of each member
+		/// @return A std::tuple with the parsed values
+		/// @throws daw::json::json_exception when a path to a non-nullable member
+		/// is not found
+		template<typename... JsonMembers, typename String>
+		[[nodiscard]] constexpr auto from_json_paths(
+		  String &&json_doc,
+		  std::string_view const ( &json_paths )[sizeof...( JsonMembers )] ) {
+			return from_json_paths<JsonMembers...>( DAW_FWD( json_doc ), json_paths,
+			                                        options::parse_flags<> );
+		}
+	} // namespace DAW_JSON_VER
+} // namespace daw::json
@@ -0,0 +1,256 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#pragma once
+
+#include "impl/version.h"
+
+#include "daw_json_default_constuctor_fwd.h"
+#include "impl/daw_json_assert.h"
+
+#include <daw/daw_attributes.h>
+#include <daw/daw_move.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <utility>
+#include <vector>
+
+namespace daw::json {
+	inline namespace DAW_JSON_VER {
+		/***
+		 * A hash map for parsing json_key_value classes into.  The pairs are stored
+		 * contiguously, in the order they were inserted, and an open addressing
+		 * table with linear probing indexes them.  When used with json_key_value
+		 * the members are counted before parsing so that the table is sized once.
+		 * As with std::unordered_map::insert, the first of duplicate keys is
+		 * kept.  Elements cannot be erased.
+		 * @tparam Key Key type.  std::string_view keys refer to the JSON document
+		 * and are not unescaped
+		 * @tparam Value Mapped type
+		 * @tparam Hash Hash function for Key
+		 * @tparam KeyEqual Equality comparison for Key
+		 */
+		template<typename Key, typename Value, typename Hash = std::hash<Key>,
+		         typename KeyEqual = std::equal_to<Key>>
+		class json_flat_map {
+		public:
+			using key_type = Key;
+			using mapped_type = Value;
+			using value_type = std::pair<Key, Value>;
+			using size_type = std::size_t;
+			using difference_type = std::ptrdiff_t;
+			using hasher = Hash;
+			using key_equal = KeyEqual;
+			using reference = value_type &;
+			using const_reference = value_type const &;
+			using iterator = typename std::vector<value_type>::iterator;
+			using const_iterator = typename std::vector<value_type>::const_iterator;
+
+		private:
+			static constexpr std::uint32_t empty_slot =
+			  std::numeric_limits<std::uint32_t>::max( );
+			static constexpr size_type min_slot_count = 8;
+
+			std::vector<value_type> m_values{ };
+			/// Index into m_values, or empty_slot
+			std::vector<std::uint32_t> m_slots{ };
+			Hash m_hash{ };
+			KeyEqual m_equal{ };
+
+			/// @brief Number of slots needed to hold size elements at a load factor
+			/// of at most 1/2
+			[[nodiscard]] static constexpr size_type slot_count_for( size_type size ) {
+				size_type result = min_slot_count;
+				while( result / 2 < size ) {
+					result *= 2;
+				}
+				return result;
+			}
+
+			/// @brief The slot holding key, or the empty slot it would be put in
+			[[nodiscard]] size_type find_slot( Key const &key ) const {
+				auto const mask = m_slots.size( ) - 1;
+				auto pos = static_cast<size_type>( m_hash( key ) ) & mask;
+				while( true ) {
+					auto const idx = m_slots[pos];
+					if( idx == empty_slot or m_equal( m_values[idx].first, key ) ) {
+						return pos;
+					}
+					pos = ( pos + 1 ) & mask;
+				}
+			}
+
+			void rehash( size_type slot_count ) {
+				m_slots.assign( slot_count, empty_slot );
+				auto const mask = slot_count - 1;
+				for( size_type n = 0; n < m_values.size( ); ++n ) {
+					auto pos = static_cast<size_type>( m_hash( m_values[n].first ) ) & mask;
+					while( m_slots[pos] != empty_slot ) {
+						pos = ( pos + 1 ) & mask;
+					}
+					m_slots[pos] = static_cast<std::uint32_t>( n );
+				}
+			}
+
+		public:
+			json_flat_map( ) = default;
+
+			/// @brief Construct an empty map that can hold size_hint elements
+			/// without rehashing
+			explicit json_flat_map( size_type size_hint ) {
+				reserve( size_hint );
+			}
+
+			/// @brief Construct from a range of value_type
+			/// @param size_hint The expected number of elements, used to size the
+			/// table once
+			template<typename Iterator, typename Last>
+			json_flat_map( Iterator first, Last last, size_type size_hint = 0 ) {
+				reserve( size_hint );
+				while( first != last ) {
+					(void)insert( *first );
+					++first;
+				}
+			}
+
+			/// @brief Ensure size elements can be held without rehashing
+			void reserve( size_type size ) {
+				daw_json_ensure( size < empty_slot, ErrorReason::NumberOutOfRange );
+				m_values.reserve( size );
+				auto const slot_count = slot_count_for( size );
+				if( slot_count > m_slots.size( ) ) {
+					rehash( slot_count );
+				}
+			}
+
+			/// @brief Insert value if its key is not already in the map
+			/// @return The element with value's key and whether value was inserted
+			std::pair<iterator, bool> insert( value_type value ) {
+				if( m_slots.empty( ) or m_values.size( ) >= m_slots.size( ) / 2 ) {
+					daw_json_ensure( m_values.size( ) + 1 < empty_slot,
+					                 ErrorReason::NumberOutOfRange );
+					rehash( slot_count_for( m_values.size( ) + 1 ) );
+				}
+				auto const pos = find_slot( value.first );
+				if( m_slots[pos] != empty_slot ) {
+					return { std::next( m_values.begin( ),
+					                    static_cast<difference_type>( m_slots[pos] ) ),
+					         false };
+				}
+				m_slots[pos] = static_cast<std::uint32_t>( m_values.size( ) );
+				m_values.push_back( std::move( value ) );
+				return { std::prev( m_values.end( ) ), true };
+			}
+
+			template<typename... Args>
+			std::pair<iterator, bool> emplace( Args &&...args ) {
+				return insert( value_type( DAW_FWD( args )... ) );
+			}
+
+			[[nodiscard]] iterator find( Key const &key ) {
+				if( m_slots.empty( ) ) {
+					return m_values.end( );
+				}
+				auto const idx = m_slots[find_slot( key )];
+				if( idx == empty_slot ) {
+					return m_values.end( );
+				}
+				return std::next( m_values.begin( ), static_cast<difference_type>( idx ) );
+			}
+
+			[[nodiscard]] const_iterator find( Key const &key ) const {
+				if( m_slots.empty( ) ) {
+					return m_values.end( );
+				}
+				auto const idx = m_slots[find_slot( key )];
+				if( idx == empty_slot ) {
+					return m_values.end( );
+				}
+				return std::next( m_values.begin( ), static_cast<difference_type>( idx ) );
+			}
+
+			[[nodiscard]] bool contains( Key const &key ) const {
+				return find( key ) != m_values.end( );
+			}
+
+			[[nodiscard]] size_type count( Key const &key ) const {
+				return contains( key ) ? 1U : 0U;
+			}
+
+			/// @brief The value mapped to key, inserting a default constructed one
+			/// when key is not in the map
+			Value &operator[]( Key const &key ) {
+				auto it = find( key );
+				if( it == m_values.end( ) ) {
+					it = insert( value_type( key, Value{ } ) ).first;
+				}
+				return it->second;
+			}
+
+			void clear( ) {
+				m_values.clear( );
+				m_slots.clear( );
+			}
+
+			[[nodiscard]] size_type size( ) const {
+				return m_values.size( );
+			}
+
+			[[nodiscard]] bool empty( ) const {
+				return m_values.empty( );
+			}
+
+			[[nodiscard]] iterator begin( ) {
+				return m_values.begin( );
+			}
+
+			[[nodiscard]] const_iterator begin( ) const {
+				return m_values.begin( );
+			}
+
+			[[nodiscard]] const_iterator cbegin( ) const {
+				return m_values.cbegin( );
+			}
+
+			[[nodiscard]] iterator end( ) {
+				return m_values.end( );
+			}
+
+			[[nodiscard]] const_iterator end( ) const {
+				return m_values.end( );
+			}
+
+			[[nodiscard]] const_iterator cend( ) const {
+				return m_values.cend( );
+			}
+		};
+
+		/// @brief Constructs json_flat_map from the json_key_value parser.  The
+		/// parser passes the number of members so the table is sized once
+		template<typename Key, typename Value, typename Hash, typename KeyEqual>
+		struct default_constructor<json_flat_map<Key, Value, Hash, KeyEqual>> {
+			using i_am_a_sized_key_value_constructor = void;
+			using map_t = json_flat_map<Key, Value, Hash, KeyEqual>;
+
+			[[nodiscard]] DAW_ATTRIB_INLINE map_t operator( )( map_t &&v ) const
+			  noexcept {
+				return std::move( v );
+			}
+
+			template<typename Iterator, typename Last>
+			[[nodiscard]] DAW_ATTRIB_INLINE map_t
+			operator( )( Iterator first, Last last, std::size_t size_hint = 0 ) const {
+				return map_t( std::move( first ), std::move( last ), size_hint );
+			}
+		};
+	} // namespace DAW_JSON_VER
+} // namespace daw::json
@@ -0,0 +1,241 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#pragma once
+
+#include "impl/version.h"
+
+#include "daw_json_link_types.h"
+#include "impl/daw_json_assert.h"
+#include "impl/daw_json_enums.h"
+#include "impl/daw_json_parse_std_string.h"
+
+#include <daw/daw_attributes.h>
+#include <daw/daw_traits.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+namespace daw::json {
+	inline namespace DAW_JSON_VER {
+		/***
+		 * A string with a fixed capacity, stored inline without allocating.  When
+		 * used as the result of a json_string, escaped strings are unescaped
+		 * directly into its storage.
+		 * @tparam Capacity Maximum number of chars held
+		 * @tparam Overflow Whether longer strings are an error or are truncated
+		 * to the last whole UTF-8 code point that fits
+		 */
+		template<std::size_t Capacity,
+		         FixedStringOverflow Overflow = FixedStringOverflow::Error>
+		class inline_string {
+			static_assert( Capacity > 0, "Capacity must be greater than 0" );
+
+			using size_storage_t = daw::conditional_t<
+			  ( Capacity <= 0xFFU ), std::uint8_t,
+			  daw::conditional_t<( Capacity <= 0xFFFFU ), std::uint16_t,
+			                     std::size_t>>;
+
+			char m_data[Capacity]{ };
+			size_storage_t m_size = 0;
+
+		public:
+			using i_am_a_fixed_capacity_string = void;
+			static constexpr std::size_t fixed_capacity = Capacity;
+			static constexpr FixedStringOverflow overflow_policy = Overflow;
+
+			using value_type = char;
+			using size_type = std::size_t;
+			using difference_type = std::ptrdiff_t;
+			using reference = char &;
+			using const_reference = char const &;
+			using pointer = char *;
+			using const_pointer = char const *;
+			using iterator = char *;
+			using const_iterator = char const *;
+
+			constexpr inline_string( ) = default;
+
+			/// @throws json_exception when size is larger than Capacity and
+			/// Overflow is Error
+			constexpr inline_string( char const *first, size_type size ) {
+				assign( first, size );
+			}
+
+			constexpr inline_string( char const *first, char const *last )
+			  : inline_string( first, static_cast<size_type>( last - first ) ) {}
+
+			explicit constexpr inline_string( std::string_view str )
+			  : inline_string( str.data( ), str.size( ) ) {}
+
+			explicit constexpr inline_string( char const *str )
+			  : inline_string( std::string_view( str ) ) {}
+
+			/// @brief Replace the contents with [first, first + size)
+			/// @throws json_exception when size is larger than Capacity and
+			/// Overflow is Error
+			constexpr void assign( char const *first, size_type size ) {
+				if( size > Capacity ) {
+					if constexpr( Overflow == FixedStringOverflow::Error ) {
+						daw_json_error( ErrorReason::StringCapacityExceeded );
+					} else {
+						for( size_type n = 0; n < Capacity; ++n ) {
+							m_data[n] = first[n];
+						}
+						m_size = static_cast<size_storage_t>(
+						  json_details::utf8_truncate( m_data, m_data + Capacity ) -
+						  m_data );
+						return;
+					}
+				}
+				for( size_type n = 0; n < size; ++n ) {
+					m_data[n] = first[n];
+				}
+				m_size = static_cast<size_storage_t>( size );
+			}
+
+			/// @brief Set the size, new chars are zero
+			/// @pre size <= Capacity
+			constexpr void resize( size_type size ) {
+				daw_json_ensure( size <= Capacity,
+				                 ErrorReason::StringCapacityExceeded );
+				for( auto n = static_cast<size_type>( m_size ); n < size; ++n ) {
+					m_data[n] = '\0';
+				}
+				m_size = static_cast<size_storage_t>( size );
+			}
+
+			/// @brief Set the size without writing to the chars.  Used after
+			/// [0, size) has already been written through data( )
+			/// @pre size <= Capacity
+			constexpr void set_size( size_type size ) {
+				daw_json_ensure( size <= Capacity,
+				                 ErrorReason::StringCapacityExceeded );
+				m_size = static_cast<size_storage_t>( size );
+			}
+
+			constexpr void clear( ) {
+				m_size = 0;
+			}
+
+			[[nodiscard]] constexpr char *data( ) {
+				return m_data;
+			}
+
+			[[nodiscard]] constexpr char const *data( ) const {
+				return m_data;
+			}
+
+			[[nodiscard]] constexpr size_type size( ) const {
+				return m_size;
+			}
+
+			[[nodiscard]] constexpr size_type length( ) const {
+				return m_size;
+			}
+
+			[[nodiscard]] static constexpr size_type capacity( ) {
+				return Capacity;
+			}
+
+			[[nodiscard]] static constexpr size_type max_size( ) {
+				return Capacity;
+			}
+
+			[[nodiscard]] constexpr bool empty( ) const {
+				return m_size == 0;
+			}
+
+			[[nodiscard]] constexpr char &operator[]( size_type idx ) {
+				return m_data[idx];
+			}
+
+			[[nodiscard]] constexpr char const &operator[]( size_type idx ) const {
+				return m_data[idx];
+			}
+
+			[[nodiscard]] constexpr iterator begin( ) {
+				return m_data;
+			}
+
+			[[nodiscard]] constexpr const_iterator begin( ) const {
+				return m_data;
+			}
+
+			[[nodiscard]] constexpr const_iterator cbegin( ) const {
+				return m_data;
+			}
+
+			[[nodiscard]] constexpr iterator end( ) {
+				return m_data + m_size;
+			}
+
+			[[nodiscard]] constexpr const_iterator end( ) const {
+				return m_data + m_size;
+			}
+
+			[[nodiscard]] constexpr const_iterator cend( ) const {
+				return m_data + m_size;
+			}
+
+			[[nodiscard]] constexpr operator std::string_view( ) const {
+				return std::string_view( m_data, m_size );
+			}
+
+			[[nodiscard]] friend constexpr bool
+			operator==( inline_string const &lhs, std::string_view rhs ) {
+				return static_cast<std::string_view>( lhs ) == rhs;
+			}
+
+			[[nodiscard]] friend constexpr bool
+			operator==( std::string_view lhs, inline_string const &rhs ) {
+				return lhs == static_cast<std::string_view>( rhs );
+			}
+
+			[[nodiscard]] friend constexpr bool
+			operator==( inline_string const &lhs, inline_string const &rhs ) {
+				return static_cast<std::string_view>( lhs ) ==
+				       static_cast<std::string_view>( rhs );
+			}
+
+			[[nodiscard]] friend constexpr bool
+			operator!=( inline_string const &lhs, std::string_view rhs ) {
+				return not( lhs == rhs );
+			}
+
+			[[nodiscard]] friend constexpr bool
+			operator!=( std::string_view lhs, inline_string const &rhs ) {
+				return not( lhs == rhs );
+			}
+
+			[[nodiscard]] friend constexpr bool
+			operator!=( inline_string const &lhs, inline_string const &rhs ) {
+				return not( lhs == rhs );
+			}
+		};
+
+		/// @brief Map a JSON string to an inline_string, without allocating
+		/// @tparam Name Name of the JSON member
+		/// @tparam Capacity Maximum number of chars held
+		/// @tparam Overflow Whether longer strings are an error or are truncated
+		template<JSONNAMETYPE Name, std::size_t Capacity,
+		         FixedStringOverflow Overflow = FixedStringOverflow::Error,
+		         json_options_t Options = string_opts_def>
+		using json_inline_string =
+		  json_string<Name, inline_string<Capacity, Overflow>, Options>;
+
+		/// @brief Map a JSON string to an inline_string, without allocating.  Used
+		/// where names are not needed, e.g. array elements
+		template<std::size_t Capacity,
+		         FixedStringOverflow Overflow = FixedStringOverflow::Error,
+		         json_options_t Options = string_opts_def>
+		using json_inline_string_no_name =
+		  json_string_no_name<inline_string<Capacity, Overflow>, Options>;
+	} // namespace DAW_JSON_VER
+} // namespace daw::json
@@ -0,0 +1,314 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#pragma once
+
+#include "impl/version.h"
+
+#include "impl/daw_json_assert.h"
+#include "impl/daw_json_parse_name.h"
+#include "impl/daw_json_parse_policy.h"
+#include "impl/daw_json_skip.h"
+#include "impl/daw_json_value.h"
+
+#include <daw/daw_string_view.h>
+
+#include <array>
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace daw::json {
+	inline namespace DAW_JSON_VER {
+		namespace json_details {
+			/***
+			 * The path of a column split into the name of the member of the record
+			 * and the path within that member, e.g. "a.b[1]" is "a" and "b[1]"
+			 */
+			class json_column_path {
+				std::string m_path;
+				std::size_t m_member_size = 0;
+				std::size_t m_rest_pos = 0;
+
+			public:
+				explicit json_column_path( std::string path )
+				  : m_path( std::move( path ) ) {
+					daw_json_ensure( not m_path.empty( ), ErrorReason::EmptyJSONPath );
+					while( m_member_size < m_path.size( ) ) {
+						char const c = m_path[m_member_size];
+						if( c == '\\' ) {
+							m_member_size += 2;
+							continue;
+						}
+						if( c == '.' or c == '[' ) {
+							break;
+						}
+						++m_member_size;
+					}
+					daw_json_ensure( m_member_size > 0 and
+					                   m_member_size <= m_path.size( ),
+					                 ErrorReason::InvalidJSONPath );
+					m_rest_pos = m_member_size;
+					if( m_rest_pos < m_path.size( ) and m_path[m_rest_pos] == '.' ) {
+						++m_rest_pos;
+					}
+				}
+
+				[[nodiscard]] std::string const &path( ) const {
+					return m_path;
+				}
+
+				/// @brief Name of the member of the record, as it appears in the path
+				[[nodiscard]] std::string_view member_name( ) const {
+					return std::string_view( m_path.data( ), m_member_size );
+				}
+
+				/// @brief The value at the path, given the value of the record member
+				template<typename JsonValue>
+				[[nodiscard]] JsonValue select( JsonValue const &member ) const {
+					if( m_rest_pos == m_path.size( ) ) {
+						return member;
+					}
+					return member.find_member( daw::string_view(
+					  m_path.data( ) + m_rest_pos, m_path.size( ) - m_rest_pos ) );
+				}
+			};
+		} // namespace json_details
+
+		/***
+		 * A column of numbers, or bools, projected from JSON Lines records.  The
+		 * values are stored contiguously.  Records where the path is missing or
+		 * null have a value initialized entry and are not present.
+		 * @tparam Number The type of each value
+		 */
+		template<typename Number>
+		class json_number_column {
+			json_details::json_column_path m_path;
+			std::vector<Number> m_values{ };
+			std::vector<bool> m_is_present{ };
+
+		public:
+			using value_type = Number;
+
+			/// @param path Member name or path, e.g. "a.b[1]", of the column in
+			/// each record
+			explicit json_number_column( std::string path )
+			  : m_path( std::move( path ) ) {}
+
+			[[nodiscard]] std::string const &path( ) const {
+				return m_path.path( );
+			}
+
+			[[nodiscard]] std::size_t size( ) const {
+				return m_values.size( );
+			}
+
+			[[nodiscard]] std::vector<Number> const &values( ) const {
+				return m_values;
+			}
+
+			[[nodiscard]] Number const &operator[]( std::size_t idx ) const {
+				return m_values[idx];
+			}
+
+			/// @brief Whether record idx had a non-null value at path
+			[[nodiscard]] bool is_present( std::size_t idx ) const {
+				return m_is_present[idx];
+			}
+
+			void reserve( std::size_t record_count ) {
+				m_values.reserve( record_count );
+				m_is_present.reserve( record_count );
+			}
+
+			void clear( ) {
+				m_values.clear( );
+				m_is_present.clear( );
+			}
+
+			[[nodiscard]] json_details::json_column_path const &column_path( ) const {
+				return m_path;
+			}
+
+			template<typename JsonValue>
+			void push_value( JsonValue const &jv ) {
+				if( not jv or jv.is_null( ) ) {
+					push_missing( );
+					return;
+				}
+				m_values.push_back( jv.template as<Number>( ) );
+				m_is_present.push_back( true );
+			}
+
+			void push_missing( ) {
+				m_values.push_back( Number{ } );
+				m_is_present.push_back( false );
+			}
+		};
+
+		/***
+		 * A column of strings projected from JSON Lines records.  The unescaped
+		 * strings are stored back to back in one blob, and value idx is
+		 * [offsets( )[idx], offsets( )[idx + 1]) of it.  Records where the path
+		 * is missing or null have an empty entry and are not present.
+		 */
+		class json_string_column {
+			json_details::json_column_path m_path;
+			std::string m_blob{ };
+			std::vector<std::size_t> m_offsets{ 0 };
+			std::vector<bool> m_is_present{ };
+
+		public:
+			using value_type = std::string_view;
+
+			/// @param path Member name or path, e.g. "a.b[1]", of the column in
+			/// each record
+			explicit json_string_column( std::string path )
+			  : m_path( std::move( path ) ) {}
+
+			[[nodiscard]] std::string const &path( ) const {
+				return m_path.path( );
+			}
+
+			[[nodiscard]] std::size_t size( ) const {
+				return m_offsets.size( ) - 1;
+			}
+
+			/// @brief The string of record idx.  It is valid until the column is
+			/// modified
+			[[nodiscard]] std::string_view operator[]( std::size_t idx ) const {
+				return std::string_view( m_blob.data( ) + m_offsets[idx],
+				                         m_offsets[idx + 1] - m_offsets[idx] );
+			}
+
+			[[nodiscard]] std::string const &blob( ) const {
+				return m_blob;
+			}
+
+			[[nodiscard]] std::vector<std::size_t> const &offsets( ) const {
+				return m_offsets;
+			}
+
+			/// @brief Whether record idx had a non-null value at path
+			[[nodiscard]] bool is_present( std::size_t idx ) const {
+				return m_is_present[idx];
+			}
+
+			void reserve( std::size_t record_count ) {
+				m_offsets.reserve( record_count + 1 );
+				m_is_present.reserve( record_count );
+			}
+
+			void clear( ) {
+				m_blob.clear( );
+				m_offsets.resize( 1 );
+				m_is_present.clear( );
+			}
+
+			[[nodiscard]] json_details::json_column_path const &column_path( ) const {
+				return m_path;
+			}
+
+			template<typename JsonValue>
+			void push_value( JsonValue const &jv ) {
+				if( not jv or jv.is_null( ) ) {
+					push_missing( );
+					return;
+				}
+				daw_json_ensure( jv.is_string( ), ErrorReason::InvalidString );
+				auto const raw = jv.get_string_view( );
+				if( raw.find( '\\' ) == std::string_view::npos ) {
+					m_blob.append( raw.data( ), raw.size( ) );
+				} else {
+					m_blob.append( jv.template as<std::string>( ) );
+				}
+				m_offsets.push_back( m_blob.size( ) );
+				m_is_present.push_back( true );
+			}
+
+			void push_missing( ) {
+				m_offsets.push_back( m_blob.size( ) );
+				m_is_present.push_back( false );
+			}
+		};
+
+		namespace json_details {
+			/***
+			 * Read the columns from the members of the class at parse_state, and
+			 * leave parse_state after the class.  The values of members not in a
+			 * column are skipped, and once every column is found the rest of the
+			 * class is skipped without looking at its members.
+			 */
+			template<typename ParseState, typename... Columns, std::size_t... Is>
+			void project_json_record( ParseState &parse_state,
+			                          std::index_sequence<Is...>,
+			                          Columns &...columns ) {
+				daw_json_ensure( parse_state.is_opening_brace_checked( ),
+				                 ErrorReason::InvalidClassStart, parse_state );
+				parse_state.remove_prefix( );
+				parse_state.trim_left( );
+
+				auto found = std::array<bool, sizeof...( Columns )>{ };
+				std::size_t found_count = 0;
+				while( found_count < sizeof...( Columns ) ) {
+					daw_json_ensure( parse_state.has_more( ),
+					                 ErrorReason::UnexpectedEndOfData, parse_state );
+					if( parse_state.front( ) == '}' ) {
+						break;
+					}
+					auto const name = parse_name( parse_state );
+					auto const member_name =
+					  std::string_view( std::data( name ), std::size( name ) );
+					(void)( ( not found[Is] and
+					          columns.column_path( ).member_name( ) == member_name and
+					          ( found[Is] = true, ++found_count,
+					            columns.push_value( columns.column_path( ).select(
+					              basic_json_value( parse_state ) ) ),
+					            true ) ),
+					        ... );
+					(void)skip_value( parse_state );
+					parse_state.move_next_member_or_end( );
+				}
+				(void)parse_state.skip_class( );
+				(void)( ( found[Is] or ( columns.push_missing( ), true ) ), ... );
+			}
+		} // namespace json_details
+
+		/***
+		 * Project the members at the paths of columns out of each record of a
+		 * JSON Lines document.  The members of each record are walked once, on
+		 * the same parse state that moves through the document, and the values
+		 * of members not in a column are skipped without being parsed.  Once
+		 * every column has been found, the rest of the record is skipped.  Each
+		 * column gets one entry per record.  The first segment of each path is
+		 * compared with the member names as they appear in the document, without
+		 * unescaping, and the first of duplicate members is used.
+		 * @param json_lines_doc A JSON Lines document of JSON classes
+		 * @param columns json_number_column's and json_string_column's
+		 * @throws daw::json::json_exception
+		 */
+		template<auto... PolicyFlags, typename... Columns>
+		void project_json_lines( daw::string_view json_lines_doc,
+		                         Columns &...columns ) {
+			static_assert( sizeof...( Columns ) > 0,
+			               "At least one column is required" );
+			using ParseState = TryDefaultParsePolicy<BasicParsePolicy<
+			  options::details::make_parse_flags<PolicyFlags...>( ).value>>;
+			auto parse_state = ParseState( std::data( json_lines_doc ),
+			                               daw::data_end( json_lines_doc ) );
+			parse_state.trim_left( );
+			while( not parse_state.is_null( ) and parse_state.has_more( ) ) {
+				json_details::project_json_record(
+				  parse_state, std::index_sequence_for<Columns...>{ }, columns... );
+				parse_state.move_next_member_or_end( );
+			}
+		}
+	} // namespace DAW_JSON_VER
+} // namespace daw::json
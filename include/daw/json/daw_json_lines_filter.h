@@ -0,0 +1,202 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#pragma once
+
+#include "impl/version.h"
+
+#include "daw_json_lines_iterator.h"
+#include "impl/daw_json_assert.h"
+#include "impl/daw_json_exec_modes.h"
+#include "impl/daw_json_value.h"
+#include "impl/daw_not_const_ex_functions.h"
+
+#include <daw/daw_move.h>
+#include <daw/daw_string_view.h>
+#include <daw/daw_traits.h>
+
+#include <cstddef>
+#include <iterator>
+#include <string_view>
+#include <type_traits>
+
+namespace daw::json {
+	inline namespace DAW_JSON_VER {
+		/***
+		 * Iterator over the records of a JSON Lines document that pass a
+		 * predicate.  The predicate is called with a json_value of each record, so
+		 * only the members it looks at are parsed.  Records that fail it are
+		 * skipped by jumping to the next newline, and JsonElement is only parsed
+		 * when dereferencing.  Records must be on a single line.
+		 * @tparam JsonElement Type each passing record is parsed to
+		 * @tparam Predicate Callable with a json_value, returning bool
+		 */
+		template<typename JsonElement, typename Predicate, auto... PolicyFlags>
+		class json_lines_filter_iterator {
+			using lines_iterator = json_lines_iterator<JsonElement, PolicyFlags...>;
+
+		public:
+			using value_type = typename lines_iterator::value_type;
+			using reference = value_type;
+			using pointer = json_details::arrow_proxy<value_type>;
+			using difference_type = std::ptrdiff_t;
+			using iterator_category = std::input_iterator_tag;
+
+		private:
+			char const *m_first = nullptr;
+			char const *m_last = nullptr;
+			Predicate const *m_predicate = nullptr;
+			/// The current record, without surrounding whitespace.  Empty when
+			/// there are no more records
+			daw::string_view m_record{ };
+
+			constexpr void find_next( ) {
+				while( m_first < m_last ) {
+					char const *const eol =
+					  json_details::mem_move_to_next_of<false, '\n'>( simd_exec_tag{ },
+					                                                  m_first, m_last );
+					char const *first = m_first;
+					char const *last = eol;
+					m_first = eol < m_last ? eol + 1 : m_last;
+					while( first < last and
+					       ( *first == ' ' or *first == '\t' or *first == '\r' ) ) {
+						++first;
+					}
+					while( last > first and ( last[-1] == ' ' or last[-1] == '\t' or
+					                          last[-1] == '\r' ) ) {
+						--last;
+					}
+					if( first == last ) {
+						continue;
+					}
+					auto const record =
+					  daw::string_view( first, static_cast<std::size_t>( last - first ) );
+					if( ( *m_predicate )( json_value( record ) ) ) {
+						m_record = record;
+						return;
+					}
+				}
+				m_record = daw::string_view{ };
+			}
+
+		public:
+			explicit json_lines_filter_iterator( ) = default;
+
+			/// @param predicate Must outlive the iterator
+			explicit constexpr json_lines_filter_iterator(
+			  daw::string_view json_lines_doc, Predicate const &predicate )
+			  : m_first( std::data( json_lines_doc ) )
+			  , m_last( daw::data_end( json_lines_doc ) )
+			  , m_predicate( &predicate ) {
+				find_next( );
+			}
+
+			/// @brief Parse the current record
+			/// @pre good( ) returns true
+			[[nodiscard]] constexpr value_type operator*( ) const {
+				daw_json_ensure( good( ), ErrorReason::UnexpectedEndOfData );
+				return *lines_iterator( m_record );
+			}
+
+			/// @brief A dereferencable value proxy holding the result of operator* .
+			/// This is for compatibility with the Iterator concepts and should be
+			/// avoided
+			/// @pre good( ) returns true
+			[[nodiscard]] constexpr pointer operator->( ) const {
+				return pointer{ operator*( ) };
+			}
+
+			/// @brief Move to the next record that passes the predicate
+			constexpr json_lines_filter_iterator &operator++( ) {
+				find_next( );
+				return *this;
+			}
+
+			constexpr void operator++( int ) & {
+				(void)operator++( );
+			}
+
+			/// @brief Is there a current record
+			[[nodiscard]] constexpr bool good( ) const {
+				return not m_record.empty( );
+			}
+
+			[[nodiscard]] explicit constexpr operator bool( ) const {
+				return good( );
+			}
+
+			[[nodiscard]] constexpr bool
+			operator==( json_lines_filter_iterator const &rhs ) const {
+				if( not good( ) or not rhs.good( ) ) {
+					return good( ) == rhs.good( );
+				}
+				return std::data( m_record ) == std::data( rhs.m_record );
+			}
+
+			[[nodiscard]] constexpr bool
+			operator!=( json_lines_filter_iterator const &rhs ) const {
+				return not operator==( rhs );
+			}
+
+			/// @brief The JSON text of the current record
+			[[nodiscard]] constexpr std::string_view get_raw_json_document( ) const {
+				return std::string_view( std::data( m_record ), std::size( m_record ) );
+			}
+		};
+
+		/// @brief A range of the records of a JSON Lines document that pass a
+		/// predicate.  See json_lines_filter_iterator
+		template<typename JsonElement, typename Predicate, auto... PolicyFlags>
+		class json_lines_filter_range {
+			daw::string_view m_json_lines_doc{ };
+			Predicate m_predicate;
+
+		public:
+			using iterator =
+			  json_lines_filter_iterator<JsonElement, Predicate, PolicyFlags...>;
+
+			explicit constexpr json_lines_filter_range(
+			  daw::string_view json_lines_doc, Predicate predicate )
+			  : m_json_lines_doc( json_lines_doc )
+			  , m_predicate( std::move( predicate ) ) {}
+
+			/// @brief The first passing record.  The iterators refer to the
+			/// predicate stored in the range
+			[[nodiscard]] constexpr iterator begin( ) const {
+				return iterator( m_json_lines_doc, m_predicate );
+			}
+
+			[[nodiscard]] constexpr iterator end( ) const {
+				return iterator( );
+			}
+
+			/// @brief Are there no passing records.  This evaluates the predicate
+			/// until the first record that passes
+			[[nodiscard]] constexpr bool empty( ) const {
+				return not begin( ).good( );
+			}
+		};
+
+		/// @brief Iterate over the records of a JSON Lines document that pass
+		/// predicate, parsing only those to JsonElement.  The predicate is called
+		/// with a json_value of the record, e.g.
+		/// []( json_value const &r ) { auto level = r["level"]; return level and
+		/// level.get_string_view( ) == "ERROR"; }
+		template<typename JsonElement = json_value, auto... PolicyFlags,
+		         typename Predicate>
+		[[nodiscard]] constexpr auto filter_json_lines( daw::string_view json_lines_doc,
+		                                               Predicate &&predicate ) {
+			static_assert( std::is_invocable_r_v<bool, Predicate, json_value>,
+			               "Predicate must be callable with a json_value and return "
+			               "bool" );
+			return json_lines_filter_range<JsonElement, daw::remove_cvref_t<Predicate>,
+			                               PolicyFlags...>( json_lines_doc,
+			                                                DAW_FWD( predicate ) );
+		}
+	} // namespace DAW_JSON_VER
+} // namespace daw::json
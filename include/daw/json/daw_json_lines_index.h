@@ -0,0 +1,424 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#pragma once
+
+#include "impl/version.h"
+
+#include "daw_json_lines_iterator.h"
+#include "impl/daw_json_assert.h"
+#include "impl/daw_json_exec_modes.h"
+#include "impl/daw_json_value.h"
+#include "impl/daw_not_const_ex_functions.h"
+
+#include <daw/daw_memory_mapped_file.h>
+#include <daw/daw_string_view.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace daw::json {
+	inline namespace DAW_JSON_VER {
+		/// @brief Controls what build_json_lines_index stores
+		struct json_lines_index_options {
+			/// @brief The number of records summarized in each block
+			std::size_t block_size = 1024U;
+			/// @brief Path, e.g. "a.b[1]", of a numeric member of each record.
+			/// When not empty, the min and max of it in each block is stored so
+			/// that blocks can be skipped when querying a range of it
+			std::string key_path{ };
+		};
+
+		namespace json_details::jsonl_index {
+			/***
+			 * The layout of an index, in native byte order, is
+			 *   header:  magic[8], version u32, flags u32, document_size u64,
+			 *            record_count u64, block_size u64, block_count u64
+			 *   offsets: u64[record_count + 1], the offset of each record and the
+			 *            size of the indexed document
+			 *   keys:    { double min, double max }[block_count], when has_keys
+			 */
+			inline constexpr char magic[8] = { 'D', 'A', 'W', 'J',
+			                                   'L', 'I', 'D', 'X' };
+			inline constexpr std::uint32_t version = 1;
+			inline constexpr std::uint32_t has_keys = 1;
+			inline constexpr std::size_t header_size = 48;
+
+			template<typename T>
+			[[nodiscard]] T read( char const *ptr ) {
+				T result;
+				std::memcpy( &result, ptr, sizeof( T ) );
+				return result;
+			}
+
+			template<typename T>
+			void append( std::vector<char> &buff, T value ) {
+				char bytes[sizeof( T )];
+				std::memcpy( bytes, &value, sizeof( T ) );
+				buff.insert( buff.end( ), bytes, bytes + sizeof( T ) );
+			}
+		} // namespace json_details::jsonl_index
+
+		/***
+		 * Build an index of the records of a JSON Lines document.  It stores the
+		 * offset of each record and, optionally, the min and max of a numeric
+		 * member for each block of records.  Records must be on a single line and
+		 * lines with only whitespace are not records.  Records without the
+		 * member, or where it is null, are not included in the min and max.
+		 * @return The index, as written by write_json_lines_index
+		 * @throws daw::json::json_exception
+		 */
+		[[nodiscard]] inline std::vector<char>
+		build_json_lines_index( daw::string_view json_lines_doc,
+		                        json_lines_index_options const &opts = { } ) {
+			namespace idx = json_details::jsonl_index;
+			daw_json_ensure( opts.block_size > 0,
+			                 ErrorReason::InvalidJSONLinesIndex );
+			constexpr auto tag = simd_exec_tag{ };
+			char const *const doc_first = std::data( json_lines_doc );
+			char const *const doc_last = daw::data_end( json_lines_doc );
+			bool const with_keys = not opts.key_path.empty( );
+			auto const key_path =
+			  daw::string_view( opts.key_path.data( ), opts.key_path.size( ) );
+
+			auto offsets = std::vector<std::uint64_t>( );
+			auto keys = std::vector<double>( );
+			double key_min = std::numeric_limits<double>::infinity( );
+			double key_max = -std::numeric_limits<double>::infinity( );
+			char const *first = doc_first;
+			while( first < doc_last ) {
+				char const *const eol = json_details::mem_move_to_next_of<false, '\n'>(
+				  tag, first, doc_last );
+				char const *record_first = first;
+				char const *record_last = eol;
+				first = eol < doc_last ? eol + 1 : doc_last;
+				while( record_first < record_last and
+				       ( *record_first == ' ' or *record_first == '\t' or
+				         *record_first == '\r' ) ) {
+					++record_first;
+				}
+				while( record_last > record_first and
+				       ( record_last[-1] == ' ' or record_last[-1] == '\t' or
+				         record_last[-1] == '\r' ) ) {
+					--record_last;
+				}
+				if( record_first == record_last ) {
+					continue;
+				}
+				offsets.push_back(
+				  static_cast<std::uint64_t>( record_first - doc_first ) );
+				if( with_keys ) {
+					auto const record = json_value( daw::string_view(
+					  record_first,
+					  static_cast<std::size_t>( record_last - record_first ) ) );
+					auto const jv = record.find_member( key_path );
+					if( jv and not jv.is_null( ) ) {
+						auto const key = jv.as<double>( );
+						if( key < key_min ) {
+							key_min = key;
+						}
+						if( key > key_max ) {
+							key_max = key;
+						}
+					}
+					if( offsets.size( ) % opts.block_size == 0 ) {
+						keys.push_back( key_min );
+						keys.push_back( key_max );
+						key_min = std::numeric_limits<double>::infinity( );
+						key_max = -std::numeric_limits<double>::infinity( );
+					}
+				}
+			}
+			auto const record_count = offsets.size( );
+			auto const block_count =
+			  ( record_count + opts.block_size - 1 ) / opts.block_size;
+			if( with_keys and keys.size( ) / 2 < block_count ) {
+				keys.push_back( key_min );
+				keys.push_back( key_max );
+			}
+			offsets.push_back( static_cast<std::uint64_t>( json_lines_doc.size( ) ) );
+
+			auto result = std::vector<char>( );
+			result.reserve( idx::header_size + offsets.size( ) * 8U +
+			                keys.size( ) * 8U );
+			result.insert( result.end( ), idx::magic, idx::magic + 8 );
+			idx::append( result, idx::version );
+			idx::append( result, with_keys ? idx::has_keys : std::uint32_t{ 0 } );
+			idx::append( result,
+			             static_cast<std::uint64_t>( json_lines_doc.size( ) ) );
+			idx::append( result, static_cast<std::uint64_t>( record_count ) );
+			idx::append( result, static_cast<std::uint64_t>( opts.block_size ) );
+			idx::append( result, static_cast<std::uint64_t>( block_count ) );
+			for( auto offset : offsets ) {
+				idx::append( result, offset );
+			}
+			for( auto key : keys ) {
+				idx::append( result, key );
+			}
+			return result;
+		}
+
+		/***
+		 * A view of an index built by build_json_lines_index, e.g. in a memory
+		 * mapped file.  It gives random access to the records of the document
+		 * it was built from, and the blocks of records that may have a key in a
+		 * range.  Records appended to the document after the index was built are
+		 * in unindexed_records( ).
+		 */
+		class json_lines_index_view {
+			char const *m_data = nullptr;
+			std::uint64_t m_document_size = 0;
+			std::size_t m_record_count = 0;
+			std::size_t m_block_size = 0;
+			std::size_t m_block_count = 0;
+			bool m_has_keys = false;
+
+			[[nodiscard]] char const *offsets_data( ) const {
+				return m_data + json_details::jsonl_index::header_size;
+			}
+
+			[[nodiscard]] char const *keys_data( ) const {
+				return offsets_data( ) + ( m_record_count + 1 ) * 8U;
+			}
+
+			[[nodiscard]] daw::string_view substr( daw::string_view json_lines_doc,
+			                                       std::size_t first,
+			                                       std::size_t last ) const {
+				daw_json_ensure( json_lines_doc.size( ) >= m_document_size,
+				                 ErrorReason::InvalidJSONLinesIndex );
+				return daw::string_view( std::data( json_lines_doc ) + first,
+				                         last - first );
+			}
+
+		public:
+			json_lines_index_view( ) = default;
+
+			/// @brief View the index in [data, data + size).  It must outlive the
+			/// view
+			/// @throws json_exception when the index is not valid
+			json_lines_index_view( char const *data, std::size_t size )
+			  : m_data( data ) {
+				namespace idx = json_details::jsonl_index;
+				daw_json_ensure( data != nullptr and size >= idx::header_size and
+				                   std::memcmp( data, idx::magic, 8 ) == 0 and
+				                   idx::read<std::uint32_t>( data + 8 ) == idx::version,
+				                 ErrorReason::InvalidJSONLinesIndex );
+				m_has_keys =
+				  ( idx::read<std::uint32_t>( data + 12 ) & idx::has_keys ) != 0;
+				m_document_size = idx::read<std::uint64_t>( data + 16 );
+				auto const record_count = idx::read<std::uint64_t>( data + 24 );
+				auto const block_size = idx::read<std::uint64_t>( data + 32 );
+				auto const block_count = idx::read<std::uint64_t>( data + 40 );
+				auto const max_records = ( size - idx::header_size ) / 8U;
+				daw_json_ensure( block_size > 0 and record_count < max_records and
+				                   block_count ==
+				                     ( record_count + block_size - 1 ) / block_size,
+				                 ErrorReason::InvalidJSONLinesIndex );
+				m_record_count = static_cast<std::size_t>( record_count );
+				m_block_size = static_cast<std::size_t>( block_size );
+				m_block_count = static_cast<std::size_t>( block_count );
+				auto const expected_size =
+				  idx::header_size + ( m_record_count + 1 ) * 8U +
+				  ( m_has_keys ? m_block_count * 16U : 0U );
+				daw_json_ensure( size == expected_size,
+				                 ErrorReason::InvalidJSONLinesIndex );
+				// The records are sliced from the document with the offsets, so
+				// they must be in order, within the document, and end at its end
+				std::size_t previous = 0;
+				for( std::size_t n = 0; n <= m_record_count; ++n ) {
+					auto const offset = record_offset( n );
+					daw_json_ensure( previous <= offset and offset <= m_document_size,
+					                 ErrorReason::InvalidJSONLinesIndex );
+					previous = offset;
+				}
+				daw_json_ensure( previous == m_document_size,
+				                 ErrorReason::InvalidJSONLinesIndex );
+			}
+
+			/// @brief The size of the document the index was built from
+			[[nodiscard]] std::size_t document_size( ) const {
+				return static_cast<std::size_t>( m_document_size );
+			}
+
+			[[nodiscard]] std::size_t record_count( ) const {
+				return m_record_count;
+			}
+
+			/// @brief The number of records in each block, except the last
+			[[nodiscard]] std::size_t block_size( ) const {
+				return m_block_size;
+			}
+
+			[[nodiscard]] std::size_t block_count( ) const {
+				return m_block_count;
+			}
+
+			/// @brief Whether the min and max of a key are stored for each block
+			[[nodiscard]] bool has_keys( ) const {
+				return m_has_keys;
+			}
+
+			/// @brief The offset of record idx in the document.  record_offset(
+			/// record_count( ) ) is document_size( )
+			[[nodiscard]] std::size_t record_offset( std::size_t idx ) const {
+				return static_cast<std::size_t>(
+				  json_details::jsonl_index::read<std::uint64_t>( offsets_data( ) +
+				                                                  idx * 8U ) );
+			}
+
+			/// @brief The JSON text of record idx
+			/// @pre idx < record_count( )
+			[[nodiscard]] std::string_view record( daw::string_view json_lines_doc,
+			                                       std::size_t idx ) const {
+				daw_json_ensure( idx < m_record_count,
+				                 ErrorReason::AttemptToAccessPastEndOfValue );
+				auto const doc = substr( json_lines_doc, record_offset( idx ),
+				                         record_offset( idx + 1 ) );
+				auto const *last = daw::data_end( doc );
+				while( last > std::data( doc ) and
+				       ( last[-1] == ' ' or last[-1] == '\t' or last[-1] == '\r' or
+				         last[-1] == '\n' ) ) {
+					--last;
+				}
+				return std::string_view(
+				  std::data( doc ),
+				  static_cast<std::size_t>( last - std::data( doc ) ) );
+			}
+
+			/// @brief The records [first, last) as a json_lines_range
+			/// @pre first <= last <= record_count( )
+			template<typename JsonElement = json_value, auto... PolicyFlags>
+			[[nodiscard]] json_lines_range<JsonElement, PolicyFlags...>
+			records( daw::string_view json_lines_doc, std::size_t first,
+			         std::size_t last ) const {
+				daw_json_ensure( first <= last and last <= m_record_count,
+				                 ErrorReason::AttemptToAccessPastEndOfValue );
+				return json_lines_range<JsonElement, PolicyFlags...>( substr(
+				  json_lines_doc, record_offset( first ), record_offset( last ) ) );
+			}
+
+			/// @brief The records appended to the document after the index was
+			/// built
+			template<typename JsonElement = json_value, auto... PolicyFlags>
+			[[nodiscard]] json_lines_range<JsonElement, PolicyFlags...>
+			unindexed_records( daw::string_view json_lines_doc ) const {
+				return json_lines_range<JsonElement, PolicyFlags...>(
+				  substr( json_lines_doc, document_size( ), json_lines_doc.size( ) ) );
+			}
+
+			/// @brief The index of the first record in block
+			[[nodiscard]] std::size_t block_first_record( std::size_t block ) const {
+				return block * m_block_size;
+			}
+
+			/// @brief One past the index of the last record in block
+			[[nodiscard]] std::size_t block_last_record( std::size_t block ) const {
+				auto const result = ( block + 1 ) * m_block_size;
+				return result < m_record_count ? result : m_record_count;
+			}
+
+			/// @brief The smallest key in block, or infinity when no record in it
+			/// has the key
+			/// @pre has_keys( ) and block < block_count( )
+			[[nodiscard]] double block_key_min( std::size_t block ) const {
+				daw_json_ensure( m_has_keys and block < m_block_count,
+				                 ErrorReason::AttemptToAccessPastEndOfValue );
+				return json_details::jsonl_index::read<double>( keys_data( ) +
+				                                                block * 16U );
+			}
+
+			/// @brief The largest key in block, or -infinity when no record in it
+			/// has the key
+			/// @pre has_keys( ) and block < block_count( )
+			[[nodiscard]] double block_key_max( std::size_t block ) const {
+				daw_json_ensure( m_has_keys and block < m_block_count,
+				                 ErrorReason::AttemptToAccessPastEndOfValue );
+				return json_details::jsonl_index::read<double>( keys_data( ) +
+				                                                block * 16U + 8U );
+			}
+
+			/***
+			 * The records of the blocks that may have a key in [key_first,
+			 * key_last].  Blocks that cannot are skipped without reading them, and
+			 * adjacent blocks are merged into one range.  The records in the ranges
+			 * must still be checked.
+			 * @pre has_keys( )
+			 */
+			template<typename JsonElement = json_value, auto... PolicyFlags>
+			[[nodiscard]] std::vector<json_lines_range<JsonElement, PolicyFlags...>>
+			key_ranges( daw::string_view json_lines_doc, double key_first,
+			            double key_last ) const {
+				daw_json_ensure( m_has_keys, ErrorReason::InvalidJSONLinesIndex );
+				auto result =
+				  std::vector<json_lines_range<JsonElement, PolicyFlags...>>( );
+				std::size_t block = 0;
+				while( block < m_block_count ) {
+					if( block_key_max( block ) < key_first or
+					    block_key_min( block ) > key_last ) {
+						++block;
+						continue;
+					}
+					auto const first = block_first_record( block );
+					while( block < m_block_count and
+					       not( block_key_max( block ) < key_first or
+					            block_key_min( block ) > key_last ) ) {
+						++block;
+					}
+					result.push_back( records<JsonElement, PolicyFlags...>(
+					  json_lines_doc, first, block_last_record( block - 1 ) ) );
+				}
+				return result;
+			}
+		};
+
+		/// @brief Write an index built by build_json_lines_index to a file,
+		/// usually next to the document, e.g. "log.jsonl.idx"
+		/// @throws json_exception when the file cannot be written
+		inline void write_json_lines_index( std::string const &index_path,
+		                                    std::vector<char> const &index ) {
+			auto out =
+			  std::ofstream( index_path, std::ios::binary | std::ios::trunc );
+			out.write( index.data( ), static_cast<std::streamsize>( index.size( ) ) );
+			out.close( );
+			daw_json_ensure( static_cast<bool>( out ), ErrorReason::OutputError );
+		}
+
+		/***
+		 * A memory mapped index file written by write_json_lines_index.  Only the
+		 * parts of the index that are used are read from disk.
+		 */
+		class json_lines_index_file {
+			daw::filesystem::memory_mapped_file_t<char> m_file;
+			json_lines_index_view m_view;
+
+		public:
+			/// @throws json_exception when the file is not a valid index
+			explicit json_lines_index_file( std::string const &index_path )
+			  : m_file( index_path )
+			  , m_view( std::data( m_file ), std::size( m_file ) ) {}
+
+			json_lines_index_file( json_lines_index_file const & ) = delete;
+			json_lines_index_file &
+			operator=( json_lines_index_file const & ) = delete;
+
+			[[nodiscard]] json_lines_index_view const &view( ) const {
+				return m_view;
+			}
+
+			[[nodiscard]] json_lines_index_view const *operator->( ) const {
+				return &m_view;
+			}
+		};
+	} // namespace DAW_JSON_VER
+} // namespace daw::json
@@ -11,8 +11,10 @@
 #include "impl/version.h"
 
 #include "impl/daw_json_link_types_fwd.h"
+#include "impl/daw_json_exec_modes.h"
 #include "impl/daw_json_parse_class.h"
 #include "impl/daw_json_value.h"
+#include "impl/daw_not_const_ex_functions.h"
 
 #include <daw/daw_cxmath.h>
 #include <daw/daw_move.h>
@@ -28,6 +30,7 @@
 #include <string>
 #include <string_view>
 #include <type_traits>
+#include <vector>
 
 namespace daw::json {
 	inline namespace DAW_JSON_VER {
@@ -245,5 +248,107 @@ namespace daw::json {
 			}
 			return result;
 		}
+
+		/// @brief The estimated cost of parsing a JSON Lines record, used to
+		/// balance partitions.  A record costs per_record + per_byte * its size.
+		/// Use { 1, 0 } to balance by record count and { 0, 1 } to balance by size
+		struct json_lines_partition_cost {
+			std::size_t per_record = 64;
+			std::size_t per_byte = 1;
+		};
+
+		/// @brief A partition of a JSON Lines document and the number of records
+		/// in it
+		template<typename JsonElement = json_value, auto... PolicyFlags>
+		struct json_lines_partition {
+			using range_t = json_lines_range<JsonElement, PolicyFlags...>;
+			using iterator = typename range_t::iterator;
+
+			range_t range;
+			std::size_t record_count;
+
+			[[nodiscard]] constexpr iterator begin( ) const {
+				return range.begin( );
+			}
+
+			[[nodiscard]] constexpr iterator end( ) const {
+				return range.end( );
+			}
+		};
+
+		/// @brief Partition the jsonl/ndjson document into at most num_partitions
+		/// non overlapping sub-ranges of about equal estimated parse cost, with
+		/// the number of records in each.  Records must be on a single line, and
+		/// lines with only whitespace are not counted.
+		template<typename JsonElement = json_value, auto... ParsePolicies>
+		std::vector<json_lines_partition<JsonElement, ParsePolicies...>>
+		partition_jsonl_document_balanced(
+		  std::size_t num_partitions, daw::string_view jsonl_doc,
+		  json_lines_partition_cost cost = json_lines_partition_cost{ } ) {
+			using partition_t = json_lines_partition<JsonElement, ParsePolicies...>;
+			using range_t = typename partition_t::range_t;
+			constexpr auto tag = simd_exec_tag{ };
+
+			auto result = std::vector<partition_t>{ };
+			if( jsonl_doc.empty( ) ) {
+				return result;
+			}
+			if( num_partitions == 0 ) {
+				num_partitions = 1;
+			}
+			char const *first = std::data( jsonl_doc );
+			char const *const last = daw::data_end( jsonl_doc );
+			// Estimate the total from the line count, blank lines included
+			auto const line_count =
+			  json_details::mem_count<'\n'>( tag, first, last ) + 1U;
+			auto const total_cost =
+			  cost.per_record * line_count + cost.per_byte * jsonl_doc.size( );
+			auto partition_cost = total_cost / num_partitions;
+			if( partition_cost == 0 ) {
+				partition_cost = 1;
+			}
+			result.reserve( num_partitions );
+
+			char const *partition_first = first;
+			std::size_t record_count = 0;
+			std::size_t cumulative_cost = 0;
+			std::size_t next_cut = partition_cost;
+			auto const add_partition = [&]( char const *partition_last ) {
+				if( record_count > 0 ) {
+					result.push_back( partition_t{
+					  range_t( daw::string_view(
+					    partition_first,
+					    static_cast<std::size_t>( partition_last - partition_first ) ) ),
+					  record_count } );
+				}
+				partition_first = partition_last;
+				record_count = 0;
+			};
+			while( first < last ) {
+				char const *const eol =
+				  json_details::mem_move_to_next_of<false, '\n'>( tag, first, last );
+				char const *ptr = first;
+				while( ptr < eol and
+				       ( *ptr == ' ' or *ptr == '\t' or *ptr == '\r' ) ) {
+					++ptr;
+				}
+				if( ptr < eol ) {
+					++record_count;
+					cumulative_cost +=
+					  cost.per_record +
+					  cost.per_byte * static_cast<std::size_t>( eol - first );
+				}
+				first = eol < last ? eol + 1 : last;
+				// Cut at multiples of partition_cost so that an expensive record does
+				// not shift every later partition
+				if( cumulative_cost >= next_cut and
+				    result.size( ) + 1 < num_partitions ) {
+					add_partition( first );
+					next_cut = ( cumulative_cost / partition_cost + 1U ) * partition_cost;
+				}
+			}
+			add_partition( last );
+			return result;
+		}
 	} // namespace DAW_JSON_VER
 } // namespace daw::json
@@ -40,6 +40,7 @@ namespace daw::json {
 		template<typename... JsonMembers>
 		struct json_member_list {
 			using i_am_a_json_member_list = void;
+			using i_am_a_seedable_json_member_list = void;
 			static_assert( json_details::are_json_types_v<JsonMembers...>,
 			               "Only JSON Link mapping types can appear in a "
 			               "json_member_list(e.g. json_number, json_string...)" );
@@ -100,6 +101,29 @@ namespace daw::json {
 				return json_details::parse_json_class<JsonClass, JsonMembers...>(
 				  parse_state, std::index_sequence_for<JsonMembers...>{ } );
 			}
+
+			/**
+			 * Parse JSON data and construct a C++ class when some of the class
+			 * members have already been passed over, e.g. while searching for the
+			 * tag member of a variant.
+			 * @tparam JsonClass The json_class mapping being parsed
+			 * @param parse_state At the first member not seen yet
+			 * @param old_class_pos Class position to restore after parsing
+			 * @param seen The members already passed over
+			 * @return A T object
+			 */
+			template<typename JsonClass, typename ParseState, typename OldClassPos,
+			         typename SeenMembers>
+			[[nodiscard]] DAW_ATTRIB_INLINE static constexpr json_details::
+			  json_result_t<JsonClass>
+			  parse_to_class_seeded( ParseState &parse_state,
+			                         OldClassPos const &old_class_pos,
+			                         SeenMembers const &seen ) {
+				static_assert( json_details::is_a_json_type_v<JsonClass> );
+				return json_details::parse_json_class_seeded<JsonClass, JsonMembers...>(
+				  parse_state, old_class_pos, seen,
+				  std::index_sequence_for<JsonMembers...>{ } );
+			}
 		};
 		///
 		/// Deduce the json type mapping based on common types and types already
@@ -0,0 +1,110 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#pragma once
+
+#include "impl/version.h"
+
+#include "daw_json_parse_options.h"
+#include "impl/daw_json_assert.h"
+#include "impl/daw_json_traits.h"
+
+#include <daw/daw_string_view.h>
+
+#include <cstddef>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <string_view>
+
+namespace daw::json {
+	inline namespace DAW_JSON_VER {
+		/***
+		 * An owning buffer of JSON text followed by json_input_padding zero
+		 * bytes.  Parsing it uses options::PaddedInput::yes and
+		 * options::ZeroTerminatedString::yes without them being specified.
+		 * Buffers from elsewhere that have the padding can be parsed with
+		 * options::PaddedInput::yes directly.
+		 */
+		class json_padded_buffer {
+			std::unique_ptr<char[]> m_data{ };
+			std::size_t m_size = 0;
+
+		public:
+			static constexpr std::size_t padding = json_input_padding;
+
+			json_padded_buffer( ) = default;
+
+			/// @brief A zero filled buffer of size bytes, to be filled using data( )
+			explicit json_padded_buffer( std::size_t size )
+			  : m_data( new char[size + padding]( ) )
+			  , m_size( size ) {}
+
+			/// @brief Copy json_doc into a padded buffer
+			explicit json_padded_buffer( daw::string_view json_doc )
+			  : json_padded_buffer( std::size( json_doc ) ) {
+				if( not json_doc.empty( ) ) {
+					std::memcpy( m_data.get( ), std::data( json_doc ),
+					             std::size( json_doc ) );
+				}
+			}
+
+			[[nodiscard]] char *data( ) {
+				return m_data.get( );
+			}
+
+			[[nodiscard]] char const *data( ) const {
+				return m_data.get( );
+			}
+
+			/// @brief The size of the JSON text, without the padding
+			[[nodiscard]] std::size_t size( ) const {
+				return m_size;
+			}
+
+			[[nodiscard]] bool empty( ) const {
+				return m_size == 0;
+			}
+
+			[[nodiscard]] char const *begin( ) const {
+				return data( );
+			}
+
+			[[nodiscard]] char const *end( ) const {
+				return data( ) + m_size;
+			}
+
+			[[nodiscard]] std::string_view string_view( ) const {
+				return std::string_view( data( ), m_size );
+			}
+		};
+
+		template<>
+		inline constexpr bool is_zero_terminated_string_v<json_padded_buffer> =
+		  true;
+
+		template<>
+		inline constexpr bool is_padded_input_v<json_padded_buffer> = true;
+
+		/// @brief Read the file at path into a json_padded_buffer
+		/// @throws daw::json::json_exception when the file cannot be read
+		[[nodiscard]] inline json_padded_buffer
+		read_json_padded_file( std::string const &path ) {
+			auto file = std::ifstream( path, std::ios::binary | std::ios::ate );
+			daw_json_ensure( static_cast<bool>( file ), ErrorReason::InputError );
+			auto const file_size = file.tellg( );
+			daw_json_ensure( file_size >= 0, ErrorReason::InputError );
+			auto result = json_padded_buffer( static_cast<std::size_t>( file_size ) );
+			file.seekg( 0 );
+			file.read( result.data( ), static_cast<std::streamsize>( file_size ) );
+			daw_json_ensure( static_cast<bool>( file ), ErrorReason::InputError );
+			return result;
+		}
+	} // namespace DAW_JSON_VER
+} // namespace daw::json
@@ -10,6 +10,8 @@
 
 #include "impl/version.h"
 
+#include <cstddef>
+
 namespace daw::json {
 	inline namespace DAW_JSON_VER {
 		namespace options {
@@ -152,7 +154,23 @@ namespace daw::json {
 				/// default: no
 				///
 				enum class ExcludeSpecialEscapes : unsigned { no, yes }; // 1bit
+
+				///
+				/// @brief The caller guarantees that json_input_padding bytes after
+				/// the end of the input can be read.  With the simd exec mode, the
+				/// kernels that search for a character, and for the end of a string,
+				/// load whole blocks without handling the tail of the input
+				/// separately.  Whitespace skipping and number parsing are scalar in
+				/// every exec mode and are not changed.  See json_padded_buffer
+				///
+				/// default: no
+				///
+				enum class PaddedInput : unsigned { no, yes }; // 1bit
 			} // namespace parser_options
 		}   // namespace options
+
+		/// @brief The number of readable bytes after the end of the input that
+		/// options::PaddedInput::yes requires
+		inline constexpr std::size_t json_input_padding = 64;
 	}     // namespace DAW_JSON_VER
 } // namespace daw::json
@@ -0,0 +1,194 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#pragma once
+
+#include "impl/version.h"
+
+#if __has_include( <version> )
+#include <version>
+#endif
+
+#if defined( __cpp_lib_memory_resource )
+#if __cpp_lib_memory_resource >= 201603L
+#define DAW_JSON_HAS_PMR
+#endif
+#endif
+
+#if defined( DAW_JSON_HAS_PMR )
+
+#include "daw_from_json.h"
+#include "impl/daw_json_assert.h"
+
+#include <daw/daw_move.h>
+
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+namespace daw::json {
+	inline namespace DAW_JSON_VER {
+		/// @brief Controls the memory resource from_json_pmr creates
+		struct json_pmr_options {
+			/// @brief The initial buffer of the resource is this multiple of the
+			/// size of the JSON document.  The resource grows geometrically past it.
+			/// Must not be negative
+			double buffer_ratio = 1.0;
+			/// @brief The smallest initial buffer
+			std::size_t min_buffer_size = 1024U;
+			/// @brief Where the resource allocates its buffers from.  Must not be
+			/// null
+			std::pmr::memory_resource *upstream = std::pmr::get_default_resource( );
+		};
+
+		/***
+		 * A parsed value and the monotonic_buffer_resource it was allocated from.
+		 * The value is destroyed before the resource, and the resource frees all
+		 * of its buffers at once.  Moving the document does not move the resource,
+		 * so allocations made by the value stay valid.
+		 * @tparam T The type of the parsed value
+		 */
+		template<typename T>
+		class json_pmr_document {
+			// Declared before the value so that it is destroyed after it
+			std::unique_ptr<std::pmr::monotonic_buffer_resource> m_resource;
+			std::optional<T> m_value;
+
+		public:
+			using value_type = T;
+
+			json_pmr_document(
+			  std::unique_ptr<std::pmr::monotonic_buffer_resource> resource,
+			  T &&value )
+			  : m_resource( std::move( resource ) )
+			  , m_value( std::move( value ) ) {}
+
+			json_pmr_document( json_pmr_document const & ) = delete;
+			json_pmr_document &operator=( json_pmr_document const & ) = delete;
+
+			json_pmr_document( json_pmr_document &&other ) noexcept(
+			  std::is_nothrow_move_constructible_v<T> )
+			  : m_resource( std::move( other.m_resource ) )
+			  , m_value( std::move( other.m_value ) ) {
+				other.m_value.reset( );
+			}
+
+			json_pmr_document &operator=( json_pmr_document &&rhs ) noexcept(
+			  std::is_nothrow_move_constructible_v<T> ) {
+				if( this != &rhs ) {
+					// The current value must be destroyed before its resource
+					m_value.reset( );
+					m_resource = std::move( rhs.m_resource );
+					m_value = std::move( rhs.m_value );
+					rhs.m_value.reset( );
+				}
+				return *this;
+			}
+
+			/// @pre The document has not been moved from
+			[[nodiscard]] T &value( ) & {
+				return *m_value;
+			}
+
+			/// @pre The document has not been moved from
+			[[nodiscard]] T const &value( ) const & {
+				return *m_value;
+			}
+
+			[[nodiscard]] T &operator*( ) & {
+				return *m_value;
+			}
+
+			[[nodiscard]] T const &operator*( ) const & {
+				return *m_value;
+			}
+
+			[[nodiscard]] T *operator->( ) {
+				return std::addressof( *m_value );
+			}
+
+			[[nodiscard]] T const *operator->( ) const {
+				return std::addressof( *m_value );
+			}
+
+			/// @brief The resource the value was allocated from, or nullptr when
+			/// the document has been moved from
+			[[nodiscard]] std::pmr::memory_resource *resource( ) const {
+				return m_resource.get( );
+			}
+		};
+
+		namespace json_details {
+			[[nodiscard]] inline std::unique_ptr<std::pmr::monotonic_buffer_resource>
+			make_document_resource( std::size_t document_size,
+			                        json_pmr_options const &opts ) {
+				daw_json_ensure( opts.upstream != nullptr and opts.buffer_ratio >= 0.0,
+				                 ErrorReason::InvalidPMROptions );
+				auto buffer_size = static_cast<std::size_t>(
+				  static_cast<double>( document_size ) * opts.buffer_ratio );
+				if( buffer_size < opts.min_buffer_size ) {
+					buffer_size = opts.min_buffer_size;
+				}
+				if( buffer_size == 0 ) {
+					buffer_size = 1;
+				}
+				return std::make_unique<std::pmr::monotonic_buffer_resource>(
+				  buffer_size, opts.upstream );
+			}
+		} // namespace json_details
+
+		/// @brief Parse JsonMember with a std::pmr::polymorphic_allocator from a
+		/// monotonic_buffer_resource owned by the result.  The resource's initial
+		/// buffer is sized from the document
+		/// @tparam JsonMember any bool, arithmetic, string, string_view,
+		/// daw::json::json_data_contract
+		/// @param json_data JSON string data
+		/// @param opts Sizing and upstream resource of the monotonic resource
+		/// @return A json_pmr_document owning the parsed value and its memory
+		/// @throws daw::json::json_exception with ErrorReason::InvalidPMROptions
+		/// when opts.upstream is null or opts.buffer_ratio is negative
+		template<typename JsonMember, bool KnownBounds = false, typename String,
+		         auto... PolicyFlags>
+		[[nodiscard]] auto
+		from_json_pmr( String &&json_data, json_pmr_options const &opts,
+		               options::parse_flags_t<PolicyFlags...> flags ) {
+			static_assert(
+			  json_details::is_string_view_like_v<String>,
+			  "String type must have a be a contiguous range of Characters" );
+			auto resource =
+			  json_details::make_document_resource( std::size( json_data ), opts );
+			auto value = from_json_alloc<JsonMember, KnownBounds>(
+			  DAW_FWD( json_data ),
+			  std::pmr::polymorphic_allocator<char>( resource.get( ) ), flags );
+			return json_pmr_document<decltype( value )>( std::move( resource ),
+			                                             std::move( value ) );
+		}
+
+		/// @brief Parse JsonMember with a std::pmr::polymorphic_allocator from a
+		/// monotonic_buffer_resource owned by the result.  The resource's initial
+		/// buffer is sized from the document
+		/// @tparam JsonMember any bool, arithmetic, string, string_view,
+		/// daw::json::json_data_contract
+		/// @param json_data JSON string data
+		/// @param opts Sizing and upstream resource of the monotonic resource
+		/// @return A json_pmr_document owning the parsed value and its memory
+		/// @throws daw::json::json_exception with ErrorReason::InvalidPMROptions
+		/// when opts.upstream is null or opts.buffer_ratio is negative
+		template<typename JsonMember, bool KnownBounds = false, typename String>
+		[[nodiscard]] auto from_json_pmr( String &&json_data,
+		                                  json_pmr_options const &opts = { } ) {
+			return from_json_pmr<JsonMember, KnownBounds>(
+			  DAW_FWD( json_data ), opts, options::parse_flags<> );
+		}
+	} // namespace DAW_JSON_VER
+} // namespace daw::json
+
+#endif
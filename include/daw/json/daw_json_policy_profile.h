@@ -0,0 +1,493 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#pragma once
+
+#include "impl/version.h"
+
+#include "daw_from_json.h"
+#include "daw_json_parse_options.h"
+#include "impl/daw_json_assert.h"
+#include "impl/daw_json_parse_options_impl.h"
+#include "impl/daw_json_parse_policy.h"
+
+#include <daw/daw_is_detected.h>
+#include <daw/daw_string_view.h>
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <iterator>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace daw::json {
+	inline namespace DAW_JSON_VER {
+		/***
+		 * The properties of sample JSON documents that decide which parse flags
+		 * are safe to use with them.  Whitespace, comments and names are only
+		 * looked for outside of strings.
+		 */
+		struct json_document_profile {
+			std::size_t document_count = 0;
+			std::size_t byte_count = 0;
+			/// Whitespace outside of strings.  MinifiedDocument::yes requires none
+			bool has_whitespace = false;
+			/// C++ style // or /* */ comments
+			bool has_cpp_comments = false;
+			/// # comments
+			bool has_hash_comments = false;
+			/// Member names with a \ escape.  AllowEscapedNames::no requires none
+			bool has_escaped_names = false;
+			std::size_t name_count = 0;
+			std::size_t name_bytes = 0;
+			std::size_t max_name_size = 0;
+
+			[[nodiscard]] constexpr bool has_comments( ) const {
+				return has_cpp_comments or has_hash_comments;
+			}
+
+			/// @brief The mean size of the member names, 0 when there are none
+			[[nodiscard]] constexpr double mean_name_size( ) const {
+				if( name_count == 0 ) {
+					return 0.0;
+				}
+				return static_cast<double>( name_bytes ) /
+				       static_cast<double>( name_count );
+			}
+
+			/// @brief Add the properties of json_doc to the profile
+			constexpr json_document_profile &add( daw::string_view json_doc ) {
+				auto const is_ws = []( char c ) {
+					return c == ' ' or c == '\t' or c == '\n' or c == '\r';
+				};
+				char const *first = std::data( json_doc );
+				char const *const last = daw::data_end( json_doc );
+				++document_count;
+				byte_count += std::size( json_doc );
+				while( first < last ) {
+					char const c = *first;
+					if( is_ws( c ) ) {
+						has_whitespace = true;
+						++first;
+					} else if( c == '#' ) {
+						has_hash_comments = true;
+						while( first < last and *first != '\n' ) {
+							++first;
+						}
+					} else if( c == '/' and last - first > 1 and first[1] == '/' ) {
+						has_cpp_comments = true;
+						while( first < last and *first != '\n' ) {
+							++first;
+						}
+					} else if( c == '/' and last - first > 1 and first[1] == '*' ) {
+						has_cpp_comments = true;
+						first += 2;
+						while( last - first > 1 and
+						       not( first[0] == '*' and first[1] == '/' ) ) {
+							++first;
+						}
+						first = last - first > 1 ? first + 2 : last;
+					} else if( c == '"' ) {
+						char const *const str_first = ++first;
+						bool is_escaped = false;
+						while( first < last and *first != '"' ) {
+							if( *first == '\\' ) {
+								is_escaped = true;
+								++first;
+							}
+							++first;
+						}
+						auto const str_size = static_cast<std::size_t>(
+						  ( first < last ? first : last ) - str_first );
+						if( first < last ) {
+							++first;
+						}
+						// A string followed by a : is a member name
+						char const *next = first;
+						while( next < last and is_ws( *next ) ) {
+							++next;
+						}
+						if( next < last and *next == ':' ) {
+							has_escaped_names |= is_escaped;
+							++name_count;
+							name_bytes += str_size;
+							if( str_size > max_name_size ) {
+								max_name_size = str_size;
+							}
+						}
+					} else {
+						++first;
+					}
+				}
+				return *this;
+			}
+		};
+
+		/// @brief Profile sample JSON documents.  See json_document_profile
+		/// @param samples A range of string like JSON documents
+		template<typename Samples>
+		[[nodiscard]] constexpr json_document_profile
+		profile_json_documents( Samples const &samples ) {
+			auto result = json_document_profile{ };
+			for( auto const &sample : samples ) {
+				(void)result.add(
+				  daw::string_view( std::data( sample ), std::size( sample ) ) );
+			}
+			return result;
+		}
+
+		/// @brief A list of parse flag sets, options::parse_flags_t, to choose
+		/// from
+		template<typename... ParseFlags>
+		struct json_policy_candidates {
+			static constexpr std::size_t size = sizeof...( ParseFlags );
+		};
+
+		/// @brief The candidates used when none are specified.  The first is the
+		/// default parse policy
+		using json_default_policy_candidates = json_policy_candidates<
+		  options::parse_flags_t<>,
+		  options::parse_flags_t<options::MinifiedDocument::yes>,
+		  options::parse_flags_t<options::ExpectLongNames::yes>,
+		  options::parse_flags_t<options::MinifiedDocument::yes,
+		                         options::ExpectLongNames::yes>,
+		  options::parse_flags_t<options::ExecModeTypes::runtime>,
+		  options::parse_flags_t<options::ExecModeTypes::simd>,
+		  options::parse_flags_t<options::ExecModeTypes::simd,
+		                         options::MinifiedDocument::yes>,
+		  options::parse_flags_t<options::PolicyCommentTypes::cpp>,
+		  options::parse_flags_t<options::PolicyCommentTypes::hash>>;
+
+		/// @brief Options for select_parse_policy
+		struct json_policy_selection_options {
+			/// The number of times the samples are parsed with each candidate.  The
+			/// fastest of them is used
+			std::size_t iterations = 5;
+			/// Whether the documents that will be parsed, and the samples, end with
+			/// a readable zero.  ZeroTerminatedString::yes candidates require it
+			bool zero_terminated_inputs = false;
+			/// Whether the documents that will be parsed, and the samples, are
+			/// followed by json_input_padding readable bytes.  PaddedInput::yes
+			/// candidates require it
+			bool padded_inputs = false;
+		};
+
+		/// @brief The result of benchmarking one candidate
+		struct json_policy_candidate_result {
+			/// The candidate is not skipped because of the document profile
+			bool is_compatible = false;
+			/// All samples parsed, and to the same values as the reference when
+			/// the parsed type is equality comparable
+			bool is_correct = false;
+			/// The fastest time to parse all of the samples
+			std::chrono::nanoseconds time{ };
+		};
+
+		/// @brief The result of select_parse_policy
+		template<std::size_t CandidateCount>
+		struct json_policy_selection {
+			json_document_profile profile{ };
+			std::array<json_policy_candidate_result, CandidateCount> results{ };
+			/// The fastest correct candidate, or CandidateCount when there is none
+			std::size_t index = CandidateCount;
+
+			[[nodiscard]] constexpr bool has_selection( ) const {
+				return index < CandidateCount;
+			}
+		};
+
+		namespace json_details {
+			template<typename T>
+			using equality_comparable_test =
+			  decltype( std::declval<T const &>( ) == std::declval<T const &>( ) );
+
+			template<typename ParseFlags>
+			[[nodiscard]] constexpr bool
+			is_compatible_policy( json_document_profile const &profile,
+			                      json_policy_selection_options const &opts ) {
+				constexpr json_options_t flags = ParseFlags::value;
+				constexpr auto minified =
+				  get_bits_for<options::MinifiedDocument>( flags );
+				constexpr auto comments =
+				  get_bits_for<options::PolicyCommentTypes>( flags );
+				constexpr auto escaped_names =
+				  get_bits_for<options::AllowEscapedNames>( flags );
+				constexpr auto zero_terminated =
+				  get_bits_for<options::ZeroTerminatedString>( flags );
+				constexpr auto padded = get_bits_for<options::PaddedInput>( flags );
+
+				if( minified == options::MinifiedDocument::yes and
+				    ( profile.has_whitespace or profile.has_comments( ) ) ) {
+					return false;
+				}
+				switch( comments ) {
+				case options::PolicyCommentTypes::none:
+					if( profile.has_comments( ) ) {
+						return false;
+					}
+					break;
+				case options::PolicyCommentTypes::cpp:
+					if( profile.has_hash_comments ) {
+						return false;
+					}
+					break;
+				case options::PolicyCommentTypes::hash:
+					if( profile.has_cpp_comments ) {
+						return false;
+					}
+					break;
+				}
+				if( escaped_names == options::AllowEscapedNames::no and
+				    profile.has_escaped_names ) {
+					return false;
+				}
+				if( zero_terminated == options::ZeroTerminatedString::yes and
+				    not opts.zero_terminated_inputs ) {
+					return false;
+				}
+				if( padded == options::PaddedInput::yes and not opts.padded_inputs ) {
+					return false;
+				}
+				return true;
+			}
+
+			template<typename T, typename ParseFlags, typename Samples>
+			[[nodiscard]] bool
+			parse_samples( Samples const &samples,
+			               std::optional<std::vector<T>> &values ) {
+#if defined( DAW_USE_EXCEPTIONS )
+				try {
+#endif
+					for( auto const &sample : samples ) {
+						auto result = from_json<T>(
+						  daw::string_view( std::data( sample ), std::size( sample ) ),
+						  ParseFlags{ } );
+						if( values ) {
+							values->push_back( std::move( result ) );
+						}
+					}
+#if defined( DAW_USE_EXCEPTIONS )
+				} catch( json_exception const & ) {
+					return false;
+				}
+#endif
+				return true;
+			}
+
+			template<typename T, typename ParseFlags, typename Samples>
+			void benchmark_policy( Samples const &samples,
+			                       json_policy_selection_options const &opts,
+			                       std::optional<std::vector<T>> &reference,
+			                       json_policy_candidate_result &result ) {
+				constexpr bool is_comparable =
+				  daw::is_detected_v<equality_comparable_test, T>;
+				auto values = std::optional<std::vector<T>>{ };
+				if constexpr( is_comparable ) {
+					values.emplace( );
+				}
+				if( not parse_samples<T, ParseFlags>( samples, values ) ) {
+					return;
+				}
+				if constexpr( is_comparable ) {
+					if( not reference ) {
+						reference = std::move( values );
+					} else if( not( *values == *reference ) ) {
+						return;
+					}
+				}
+				result.is_correct = true;
+				auto no_values = std::optional<std::vector<T>>{ };
+				for( std::size_t n = 0; n < opts.iterations; ++n ) {
+					auto const start = std::chrono::steady_clock::now( );
+					(void)parse_samples<T, ParseFlags>( samples, no_values );
+					auto const time =
+					  std::chrono::duration_cast<std::chrono::nanoseconds>(
+					    std::chrono::steady_clock::now( ) - start );
+					if( n == 0 or time < result.time ) {
+						result.time = time;
+					}
+				}
+			}
+
+			template<typename T, typename Samples, typename... ParseFlags,
+			         std::size_t... Is>
+			[[nodiscard]] json_policy_selection<sizeof...( ParseFlags )>
+			select_parse_policy( Samples const &samples,
+			                     json_policy_selection_options const &opts,
+			                     json_policy_candidates<ParseFlags...>,
+			                     std::index_sequence<Is...> ) {
+				auto result = json_policy_selection<sizeof...( ParseFlags )>{ };
+				result.profile = profile_json_documents( samples );
+				auto reference = std::optional<std::vector<T>>{ };
+				(void)( ( result.results[Is].is_compatible =
+				            is_compatible_policy<ParseFlags>( result.profile, opts ),
+				          result.results[Is].is_compatible and
+				            ( benchmark_policy<T, ParseFlags>(
+				                samples, opts, reference, result.results[Is] ),
+				              true ) ),
+				        ... );
+				for( std::size_t n = 0; n < sizeof...( ParseFlags ); ++n ) {
+					auto const &r = result.results[n];
+					if( r.is_correct and
+					    ( not result.has_selection( ) or
+					      r.time < result.results[result.index].time ) ) {
+						result.index = n;
+					}
+				}
+				return result;
+			}
+
+			template<typename ParseFlags>
+			[[nodiscard]] std::string describe_parse_flags( ) {
+				constexpr json_options_t flags = ParseFlags::value;
+				auto result = std::string( "ExecModeTypes::" );
+				auto const mode =
+				  to_string( get_bits_for<options::ExecModeTypes>( flags ) );
+				result.append( std::data( mode ), std::size( mode ) );
+				auto const append = [&]( char const *name, bool is_set ) {
+					if( is_set ) {
+						result += ", ";
+						result += name;
+					}
+				};
+				append( "MinifiedDocument::yes",
+				        get_bits_for<options::MinifiedDocument>( flags ) ==
+				          options::MinifiedDocument::yes );
+				append( "ExpectLongNames::yes",
+				        get_bits_for<options::ExpectLongNames>( flags ) ==
+				          options::ExpectLongNames::yes );
+				append( "ZeroTerminatedString::yes",
+				        get_bits_for<options::ZeroTerminatedString>( flags ) ==
+				          options::ZeroTerminatedString::yes );
+				append( "PolicyCommentTypes::cpp",
+				        get_bits_for<options::PolicyCommentTypes>( flags ) ==
+				          options::PolicyCommentTypes::cpp );
+				append( "PolicyCommentTypes::hash",
+				        get_bits_for<options::PolicyCommentTypes>( flags ) ==
+				          options::PolicyCommentTypes::hash );
+				append( "CheckedParseMode::no",
+				        get_bits_for<options::CheckedParseMode>( flags ) ==
+				          options::CheckedParseMode::no );
+				append( "AllowEscapedNames::yes",
+				        get_bits_for<options::AllowEscapedNames>( flags ) ==
+				          options::AllowEscapedNames::yes );
+				append( "PaddedInput::yes",
+				        get_bits_for<options::PaddedInput>( flags ) ==
+				          options::PaddedInput::yes );
+				return result;
+			}
+
+			template<typename... ParseFlags>
+			[[nodiscard]] std::string
+			describe_policy_candidate( json_policy_candidates<ParseFlags...>,
+			                           std::size_t index ) {
+				auto result = std::string( );
+				std::size_t n = 0;
+				(void)( ( n++ == index and
+				          ( result = describe_parse_flags<ParseFlags>( ), true ) ) or
+				        ... );
+				return result;
+			}
+		} // namespace json_details
+
+		/// @brief A description of the non-default profiled flags of candidate
+		/// index, e.g. "ExecModeTypes::simd, MinifiedDocument::yes"
+		template<typename Candidates>
+		[[nodiscard]] std::string describe_policy_candidate( std::size_t index ) {
+			return json_details::describe_policy_candidate( Candidates{ }, index );
+		}
+
+		/***
+		 * Choose the fastest of the candidate parse flag sets that correctly parse
+		 * the samples to T.  Candidates that the profile of the samples shows are
+		 * unsafe, e.g. MinifiedDocument::yes with whitespace, are skipped.  The
+		 * others parse each sample and are rejected when that fails.  When T is
+		 * equality comparable the values must also equal those of the first
+		 * candidate that parsed them, so list the most conservative first.
+		 * @tparam T The type being parsed
+		 * @tparam Candidates A json_policy_candidates list of parse flag sets
+		 * @param samples A range of string like JSON documents representative of
+		 * the inputs
+		 * @return The profile, the result of each candidate and the index of the
+		 * fastest correct one
+		 */
+		template<typename T, typename Candidates = json_default_policy_candidates,
+		         typename Samples>
+		[[nodiscard]] json_policy_selection<Candidates::size>
+		select_parse_policy( Samples const &samples,
+		                     json_policy_selection_options const &opts = { } ) {
+			return json_details::select_parse_policy<T>(
+			  samples, opts, Candidates{ },
+			  std::make_index_sequence<Candidates::size>{ } );
+		}
+
+		template<typename T, typename Candidates = json_default_policy_candidates>
+		class json_policy_dispatcher;
+
+		/***
+		 * Parses T with one of the candidate parse flag sets, chosen at runtime.
+		 * Construct it from the result of select_parse_policy.  Every candidate
+		 * is instantiated.
+		 * @tparam T The type being parsed
+		 * @tparam Candidates A json_policy_candidates list of parse flag sets
+		 */
+		template<typename T, typename... ParseFlags>
+		class json_policy_dispatcher<T, json_policy_candidates<ParseFlags...>> {
+			using candidates_t = json_policy_candidates<ParseFlags...>;
+			std::size_t m_index = 0;
+
+			template<typename String, std::size_t... Is>
+			[[nodiscard]] auto parse_impl( String const &json_data,
+			                               std::index_sequence<Is...> ) const {
+				using value_t = json_details::json_result_t<
+				  json_details::json_deduced_type<T>>;
+				auto result = std::optional<value_t>{ };
+				(void)( ( m_index == Is and
+				          ( result.emplace( from_json<T>( json_data, ParseFlags{ } ) ),
+				            true ) ) or
+				        ... );
+				return std::move( *result );
+			}
+
+		public:
+			/// @brief Use the first candidate
+			explicit json_policy_dispatcher( ) = default;
+
+			/// @pre index < sizeof...( ParseFlags )
+			explicit constexpr json_policy_dispatcher( std::size_t index )
+			  : m_index( index ) {
+				daw_json_ensure( index < sizeof...( ParseFlags ),
+				                 ErrorReason::AttemptToAccessPastEndOfValue );
+			}
+
+			/// @brief Use the candidate selected, or the first when none was
+			explicit constexpr json_policy_dispatcher(
+			  json_policy_selection<sizeof...( ParseFlags )> const &selection )
+			  : m_index( selection.has_selection( ) ? selection.index : 0 ) {}
+
+			[[nodiscard]] constexpr std::size_t index( ) const {
+				return m_index;
+			}
+
+			[[nodiscard]] std::string description( ) const {
+				return describe_policy_candidate<candidates_t>( m_index );
+			}
+
+			/// @brief Parse json_data with the chosen candidate
+			/// @throws daw::json::json_exception
+			template<typename String>
+			[[nodiscard]] auto parse( String const &json_data ) const {
+				return parse_impl( json_data,
+				                   std::index_sequence_for<ParseFlags...>{ } );
+			}
+		};
+	} // namespace DAW_JSON_VER
+} // namespace daw::json
@@ -0,0 +1,85 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#pragma once
+
+#include "impl/version.h"
+
+#include "daw_json_lines_iterator.h"
+#include "impl/daw_json_parse_policy.h"
+#include "impl/daw_json_skip.h"
+
+#include <daw/daw_string_view.h>
+
+#include <cstddef>
+#include <vector>
+
+namespace daw::json {
+	inline namespace DAW_JSON_VER {
+		/// @brief Iterator over a sequence of concatenated JSON values, e.g.
+		/// {...}{...} or values separated by any whitespace.  The end of each value
+		/// is found by skipping it, so newlines are not needed between them.
+		/// @tparam JsonElement type of each value in the sequence
+		template<typename JsonElement = json_value, auto... PolicyFlags>
+		using json_sequence_iterator =
+		  json_lines_iterator<JsonElement, PolicyFlags...>;
+
+		/// @brief A range of json_sequence_iterators
+		/// @tparam JsonElement type of each value in the sequence
+		template<typename JsonElement = json_value, auto... PolicyFlags>
+		using json_sequence_range = json_lines_range<JsonElement, PolicyFlags...>;
+
+		/// @brief Partition a sequence of concatenated JSON values into
+		/// num_partitions non overlapping sub-ranges of about equal size.  This can
+		/// be used to parallelize parsing of the sequence.  Value boundaries
+		/// cannot be found from an arbitrary position, so the values are skipped,
+		/// without being parsed, from the start of the document
+		template<typename JsonElement = json_value, auto... ParsePolicies>
+		std::vector<json_sequence_range<JsonElement, ParsePolicies...>>
+		partition_json_sequence_document( std::size_t num_partitions,
+		                                  daw::string_view json_sequence_doc ) {
+			using result_t =
+			  std::vector<json_sequence_range<JsonElement, ParsePolicies...>>;
+			if( num_partitions <= 1 ) {
+				return result_t{ json_sequence_range<JsonElement, ParsePolicies...>(
+				  json_sequence_doc ) };
+			}
+			using ParseState = TryDefaultParsePolicy<BasicParsePolicy<
+			  options::details::make_parse_flags<ParsePolicies...>( ).value>>;
+
+			auto const approx_segsize = json_sequence_doc.size( ) / num_partitions;
+			auto result = result_t{ };
+			result.reserve( num_partitions );
+			auto parse_state = ParseState( std::data( json_sequence_doc ),
+			                               daw::data_end( json_sequence_doc ) );
+			parse_state.trim_left( );
+			while( parse_state.has_more( ) ) {
+				char const *const partition_first = parse_state.first;
+				// The last partition takes the remainder without skipping it
+				if( result.size( ) + 1 == num_partitions ) {
+					result.emplace_back( daw::string_view(
+					  partition_first, static_cast<std::size_t>(
+					                     parse_state.last - partition_first ) ) );
+					break;
+				}
+				do {
+					(void)json_details::skip_value( parse_state );
+					parse_state.move_next_member_or_end( );
+				} while( parse_state.has_more( ) and
+				         static_cast<std::size_t>( parse_state.first -
+				                                   partition_first ) < approx_segsize );
+				auto doc = daw::string_view(
+				  partition_first,
+				  static_cast<std::size_t>( parse_state.first - partition_first ) );
+				doc.trim_suffix( );
+				result.emplace_back( doc );
+			}
+			return result;
+		}
+	} // namespace DAW_JSON_VER
+} // namespace daw::json
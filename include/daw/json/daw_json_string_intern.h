@@ -0,0 +1,221 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#pragma once
+
+#include "impl/version.h"
+
+#include "daw_json_link_types.h"
+
+#include <daw/daw_attributes.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace daw::json {
+	inline namespace DAW_JSON_VER {
+		/***
+		 * Stores one copy of each distinct string interned.  The string_views
+		 * returned by intern( ) refer to the pool and are valid until the pool is
+		 * cleared or destroyed.  Moving the pool keeps them valid.
+		 */
+		class json_string_intern_pool {
+			static constexpr std::size_t block_size = 16U * 1024U;
+			static constexpr std::size_t min_slot_count = 64U;
+
+			std::vector<std::unique_ptr<char[]>> m_blocks{ };
+			char *m_block_pos = nullptr;
+			std::size_t m_block_remaining = 0;
+			/// Open addressing table of the interned strings.  Empty slots have a
+			/// null data( )
+			std::vector<std::string_view> m_slots{ };
+			std::size_t m_size = 0;
+			std::size_t m_bytes = 0;
+
+			[[nodiscard]] static std::size_t hash( std::string_view str ) {
+				return std::hash<std::string_view>{ }( str );
+			}
+
+			[[nodiscard]] std::size_t find_slot( std::string_view str ) const {
+				auto const mask = m_slots.size( ) - 1;
+				auto pos = hash( str ) & mask;
+				while( m_slots[pos].data( ) != nullptr and m_slots[pos] != str ) {
+					pos = ( pos + 1 ) & mask;
+				}
+				return pos;
+			}
+
+			void grow( ) {
+				auto old_slots = std::exchange(
+				  m_slots, std::vector<std::string_view>(
+				             std::max( min_slot_count, m_slots.size( ) * 2 ) ) );
+				for( auto const &str : old_slots ) {
+					if( str.data( ) != nullptr ) {
+						m_slots[find_slot( str )] = str;
+					}
+				}
+			}
+
+			[[nodiscard]] char *allocate( std::size_t size ) {
+				if( size > m_block_remaining ) {
+					if( size > block_size / 4 ) {
+						// Large strings get their own block, leaving the current one
+						// for small strings
+						return m_blocks.emplace_back( new char[size] ).get( );
+					}
+					m_block_pos = m_blocks.emplace_back( new char[block_size] ).get( );
+					m_block_remaining = block_size;
+				}
+				auto *const result = m_block_pos;
+				m_block_pos += size;
+				m_block_remaining -= size;
+				return result;
+			}
+
+		public:
+			json_string_intern_pool( ) = default;
+			json_string_intern_pool( json_string_intern_pool const & ) = delete;
+			json_string_intern_pool &
+			operator=( json_string_intern_pool const & ) = delete;
+			json_string_intern_pool( json_string_intern_pool && ) noexcept = default;
+			json_string_intern_pool &
+			operator=( json_string_intern_pool && ) noexcept = default;
+			~json_string_intern_pool( ) = default;
+
+			/// @brief Find str in the pool, adding a copy of it when it is not there
+			/// @return A view of the pooled copy of str
+			[[nodiscard]] std::string_view intern( std::string_view str ) {
+				if( str.empty( ) ) {
+					return { };
+				}
+				if( ( m_size + 1 ) * 2 > m_slots.size( ) ) {
+					grow( );
+				}
+				auto &slot = m_slots[find_slot( str )];
+				if( slot.data( ) == nullptr ) {
+					auto *const data = allocate( str.size( ) );
+					std::copy( str.begin( ), str.end( ), data );
+					slot = std::string_view( data, str.size( ) );
+					++m_size;
+					m_bytes += str.size( );
+				}
+				return slot;
+			}
+
+			/// @brief The number of distinct strings in the pool
+			[[nodiscard]] std::size_t size( ) const {
+				return m_size;
+			}
+
+			/// @brief The number of characters stored for the distinct strings
+			[[nodiscard]] std::size_t bytes_stored( ) const {
+				return m_bytes;
+			}
+
+			/// @brief Release all strings.  Views previously returned by intern( )
+			/// are no longer valid
+			void clear( ) {
+				m_blocks.clear( );
+				m_block_pos = nullptr;
+				m_block_remaining = 0;
+				m_slots.clear( );
+				m_size = 0;
+				m_bytes = 0;
+			}
+		};
+
+		namespace json_details {
+			[[nodiscard]] inline json_string_intern_pool *&
+			current_string_intern_pool( ) {
+				static thread_local json_string_intern_pool *pool = nullptr;
+				return pool;
+			}
+		} // namespace json_details
+
+		/// @brief The pool used by the current thread when no
+		/// json_string_intern_scope is active.  It lives as long as the thread
+		[[nodiscard]] inline json_string_intern_pool &
+		thread_string_intern_pool( ) {
+			static thread_local json_string_intern_pool pool{ };
+			return pool;
+		}
+
+		/// @brief The pool json_interned_string members are interned into on the
+		/// current thread
+		[[nodiscard]] inline json_string_intern_pool &current_string_intern_pool( ) {
+			auto *const pool = json_details::current_string_intern_pool( );
+			if( pool != nullptr ) {
+				return *pool;
+			}
+			return thread_string_intern_pool( );
+		}
+
+		/***
+		 * Intern strings parsed on the current thread into pool for the lifetime
+		 * of the scope, e.g. one pool per parse.  Scopes can be nested and the
+		 * previous pool is restored on destruction.
+		 */
+		class json_string_intern_scope {
+			json_string_intern_pool *m_previous;
+
+		public:
+			explicit json_string_intern_scope( json_string_intern_pool &pool )
+			  : m_previous(
+			      std::exchange( json_details::current_string_intern_pool( ), &pool ) ) {}
+
+			json_string_intern_scope( json_string_intern_scope const & ) = delete;
+			json_string_intern_scope &
+			operator=( json_string_intern_scope const & ) = delete;
+
+			~json_string_intern_scope( ) {
+				json_details::current_string_intern_pool( ) = m_previous;
+			}
+		};
+
+		/// @brief Constructor for json_string that interns the unescaped string in
+		/// current_string_intern_pool( ) and results in a std::string_view of the
+		/// pooled copy
+		struct intern_string_constructor {
+			[[nodiscard]] std::string_view operator( )( ) const {
+				return { };
+			}
+
+			[[nodiscard]] std::string_view operator( )( std::string_view str ) const {
+				return current_string_intern_pool( ).intern( str );
+			}
+
+			[[nodiscard]] std::string_view operator( )( char const *first,
+			                                            char const *last ) const {
+				return current_string_intern_pool( ).intern( std::string_view(
+				  first, static_cast<std::size_t>( last - first ) ) );
+			}
+
+			[[nodiscard]] std::string_view operator( )( char const *first,
+			                                            std::size_t size ) const {
+				return current_string_intern_pool( ).intern(
+				  std::string_view( first, size ) );
+			}
+		};
+
+		/// @brief A json_string that parses to a std::string_view of an interned
+		/// copy.  Equal strings share one copy in current_string_intern_pool( )
+		template<JSONNAMETYPE Name, json_options_t Options = string_opts_def>
+		using json_interned_string =
+		  json_string<Name, std::string, Options, intern_string_constructor>;
+
+		template<json_options_t Options = string_opts_def>
+		using json_interned_string_no_name =
+		  json_string_no_name<std::string, Options, intern_string_constructor>;
+	} // namespace DAW_JSON_VER
+} // namespace daw::json
@@ -0,0 +1,311 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#pragma once
+
+#include "impl/version.h"
+
+#include "daw_json_event_parser.h"
+#include "impl/daw_json_assert.h"
+#include "impl/daw_json_parse_name.h"
+#include "impl/daw_json_parse_policy.h"
+#include "impl/daw_json_parse_value.h"
+#include "impl/daw_json_skip.h"
+
+#include <daw/daw_string_view.h>
+#include <daw/stdinc/data_access.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace daw::json {
+	inline namespace DAW_JSON_VER {
+		/// @brief The tokens produced by basic_json_token_cursor
+		enum class JsonTokenTypes : std::uint8_t {
+			/// No current token, either before the first call to next_token or at
+			/// the end of the document
+			None,
+			ClassStart,
+			ClassEnd,
+			ArrayStart,
+			ArrayEnd,
+			String,
+			Number,
+			Bool,
+			Null
+		};
+
+		/// @brief A non-recursive pull parser over a JSON document.  Each call to
+		/// next_token( ) moves to the next token, and the current token can be
+		/// queried without constructing a basic_json_value.  Class and array starts
+		/// can be skipped whole with skip( ) or parsed into a mapped type with
+		/// get_value<T>( ).
+		/// @tparam PolicyFlags Parser Policy flags.  See parser_policies.md
+		/// @tparam Allocator An optional allocator passed to parsed values
+		/// @tparam StackType The stack of open classes/arrays.  It needs
+		/// push_back, back, pop_back, empty and size
+		template<json_options_t PolicyFlags = json_details::default_policy_flag,
+		         typename Allocator = json_details::NoAllocator,
+		         typename StackType = std::vector<StackParseStateType>>
+		class basic_json_token_cursor {
+		public:
+			using ParseState =
+			  TryDefaultParsePolicy<BasicParsePolicy<PolicyFlags, Allocator>>;
+			using CharT = typename ParseState::CharT;
+
+		private:
+			ParseState m_state{ };
+			StackType m_stack{ };
+			daw::string_view m_key{ };
+			CharT *m_value_first = nullptr;
+			CharT *m_value_last = nullptr;
+			JsonTokenTypes m_token = JsonTokenTypes::None;
+			bool m_has_key = false;
+			// The current token is a class/array start that has not been entered
+			bool m_is_pending_start = false;
+			bool m_is_done = false;
+
+			constexpr void move_past_value( ) {
+				if( m_stack.empty( ) ) {
+					m_state.trim_left( );
+					m_is_done = true;
+				} else {
+					m_state.move_next_member_or_end( );
+				}
+			}
+
+			constexpr void enter_pending_start( ) {
+				m_stack.push_back( m_token == JsonTokenTypes::ClassStart
+				                     ? StackParseStateType::Class
+				                     : StackParseStateType::Array );
+				m_state.remove_prefix( );
+				m_state.trim_left_checked( );
+				m_is_pending_start = false;
+			}
+
+			/// @brief The pending start was consumed, e.g. by skipping or parsing it.
+			/// The current token becomes the matching end.
+			constexpr void finish_pending_start( ) {
+				m_token = m_token == JsonTokenTypes::ClassStart
+				            ? JsonTokenTypes::ClassEnd
+				            : JsonTokenTypes::ArrayEnd;
+				m_is_pending_start = false;
+				m_value_last = m_state.first;
+				move_past_value( );
+			}
+
+		public:
+			basic_json_token_cursor( ) = default;
+
+			/// @brief Construct a cursor at the start of the document
+			/// @param json_doc The document to parse.  It must outlive the cursor
+			explicit constexpr basic_json_token_cursor( daw::string_view json_doc )
+			  : m_state( std::data( json_doc ), daw::data_end( json_doc ) ) {
+				m_state.trim_left_checked( );
+			}
+
+			explicit constexpr basic_json_token_cursor( daw::string_view json_doc,
+			                                            Allocator &alloc )
+			  : m_state( std::data( json_doc ), daw::data_end( json_doc ), alloc ) {
+				m_state.trim_left_checked( );
+			}
+
+			/// @brief Move to the next token
+			/// @return The new current token.  JsonTokenTypes::None at the end of
+			/// the document
+			constexpr JsonTokenTypes next_token( ) {
+				if( m_is_pending_start ) {
+					enter_pending_start( );
+				}
+				m_has_key = false;
+				if( m_is_done or ( m_stack.empty( ) and not m_state.has_more( ) ) ) {
+					m_token = JsonTokenTypes::None;
+					return m_token;
+				}
+				if( not m_stack.empty( ) ) {
+					daw_json_assert_weak( m_state.has_more( ),
+					                      ErrorReason::UnexpectedEndOfData, m_state );
+					char const c = m_state.front( );
+					if( c == '}' or c == ']' ) {
+						bool const is_class = c == '}';
+						daw_json_assert_weak(
+						  is_class == ( m_stack.back( ) == StackParseStateType::Class ),
+						  ErrorReason::InvalidBracketing, m_state );
+						m_value_first = m_state.first;
+						m_state.remove_prefix( );
+						m_value_last = m_state.first;
+						m_stack.pop_back( );
+						m_token =
+						  is_class ? JsonTokenTypes::ClassEnd : JsonTokenTypes::ArrayEnd;
+						move_past_value( );
+						return m_token;
+					}
+					if( m_stack.back( ) == StackParseStateType::Class ) {
+						daw_json_assert_weak( m_state.is_quotes_checked( ),
+						                      ErrorReason::MissingMemberName, m_state );
+						m_key = json_details::parse_name( m_state );
+						m_has_key = true;
+					}
+				}
+				m_value_first = m_state.first;
+				switch( m_state.front( ) ) {
+				case '{':
+					m_token = JsonTokenTypes::ClassStart;
+					m_is_pending_start = true;
+					return m_token;
+				case '[':
+					m_token = JsonTokenTypes::ArrayStart;
+					m_is_pending_start = true;
+					return m_token;
+				case '"': {
+					m_token = JsonTokenTypes::String;
+					auto const str = json_details::skip_string( m_state );
+					m_value_first = str.first;
+					m_value_last = str.last;
+					move_past_value( );
+					return m_token;
+				}
+				case 't':
+				case 'f':
+					m_token = JsonTokenTypes::Bool;
+					break;
+				case 'n':
+					m_token = JsonTokenTypes::Null;
+					break;
+				default:
+					m_token = JsonTokenTypes::Number;
+					break;
+				}
+				auto const lit = json_details::skip_literal( m_state );
+				m_value_first = lit.first;
+				m_value_last = lit.last;
+				move_past_value( );
+				return m_token;
+			}
+
+			/// @brief Skip the current value.  When at a class or array start the
+			/// whole class/array is skipped and the current token becomes the
+			/// matching end.  Other tokens are already consumed.
+			constexpr void skip( ) {
+				if( m_is_pending_start ) {
+					(void)json_details::skip_value( m_state );
+					finish_pending_start( );
+				}
+			}
+
+			/// @brief Parse the current value as a Result.  The Result type must be
+			/// supported or mapped via a json_data_contract.  When at a class or
+			/// array start, the whole class/array is parsed and the current token
+			/// becomes the matching end.
+			/// @pre The current token is a value, or a class/array start.  Before
+			/// the first token or after the last it is UnexpectedEndOfData, and
+			/// at a class/array end it is InvalidStartOfValue
+			template<typename Result>
+			[[nodiscard]] constexpr auto get_value( ) {
+				using json_member = json_details::json_deduced_type<Result>;
+				if( m_is_pending_start ) {
+					auto result =
+					  json_details::parse_value<json_member, false,
+					                            json_member::expected_type>( m_state );
+					finish_pending_start( );
+					return result;
+				}
+				daw_json_assert_weak( m_token != JsonTokenTypes::None,
+				                      ErrorReason::UnexpectedEndOfData );
+				// The end of a class or array is not the start of a value
+				daw_json_assert_weak( m_token != JsonTokenTypes::ClassEnd and
+				                        m_token != JsonTokenTypes::ArrayEnd,
+				                      ErrorReason::InvalidStartOfValue );
+				auto first = m_value_first;
+				if( m_token == JsonTokenTypes::String ) {
+					// Include the opening quote for the string parsers
+					--first;
+				}
+				auto parse_state = m_state.copy( first, m_state.last, first,
+				                                 m_state.last );
+				return json_details::parse_value<json_member, false,
+				                                 json_member::expected_type>(
+				  parse_state );
+			}
+
+			/// @brief Parse the current number token
+			template<typename Number = double>
+			[[nodiscard]] constexpr Number get_number( ) {
+				daw_json_assert_weak( m_token == JsonTokenTypes::Number,
+				                      ErrorReason::InvalidNumber );
+				return get_value<Number>( );
+			}
+
+			/// @brief Value of the current bool token
+			[[nodiscard]] constexpr bool get_bool( ) const {
+				daw_json_assert_weak( m_token == JsonTokenTypes::Bool,
+				                      ErrorReason::InvalidLiteral );
+				return *m_value_first == 't';
+			}
+
+			/// @brief Parse the current string token, unescaping it
+			[[nodiscard]] std::string get_string( ) {
+				daw_json_assert_weak( m_token == JsonTokenTypes::String,
+				                      ErrorReason::InvalidString );
+				return get_value<std::string>( );
+			}
+
+			/// @brief The raw text of the current token.  Strings are without their
+			/// quotes and are not unescaped.  Not valid for class/array starts
+			[[nodiscard]] constexpr std::string_view get_string_view( ) const {
+				if( m_is_pending_start or m_value_first == nullptr ) {
+					return { };
+				}
+				return std::string_view(
+				  m_value_first,
+				  static_cast<std::size_t>( m_value_last - m_value_first ) );
+			}
+
+			/// @brief The member name of the current value when it is a class
+			/// member.  The name is as it is in the document and is not unescaped.
+			[[nodiscard]] constexpr std::optional<std::string_view>
+			current_key( ) const {
+				if( not m_has_key ) {
+					return std::nullopt;
+				}
+				return std::string_view( std::data( m_key ), std::size( m_key ) );
+			}
+
+			/// @brief The current token
+			[[nodiscard]] constexpr JsonTokenTypes token( ) const {
+				return m_token;
+			}
+
+			/// @brief The number of open classes/arrays.  A pending class/array start
+			/// is not counted until the next token is read
+			[[nodiscard]] constexpr std::size_t depth( ) const {
+				return std::size( m_stack );
+			}
+
+			/// @brief Has the whole document been read
+			[[nodiscard]] constexpr bool is_done( ) const {
+				return m_token == JsonTokenTypes::None and
+				       ( m_is_done or not m_state.has_more( ) );
+			}
+
+			/// Get access to the internal state.  Should not be used as part of
+			/// public API
+			[[nodiscard]] constexpr ParseState const &get_raw_state( ) const {
+				return m_state;
+			}
+		};
+
+		basic_json_token_cursor( daw::string_view ) -> basic_json_token_cursor<>;
+
+		using json_token_cursor = basic_json_token_cursor<>;
+	} // namespace DAW_JSON_VER
+} // namespace daw::json
@@ -19,8 +19,10 @@
 #include <daw/daw_move.h>
 #include <daw/daw_string_view.h>
 #include <daw/daw_uint_buffer.h>
+#include <daw/traits/daw_traits_conditional.h>
 
 #include <cstddef>
+#include <cstdint>
 #include <string_view>
 #include <utility>
 #include <vector>
@@ -59,6 +61,88 @@ namespace daw::json {
 					return name == Name;
 				}
 			};
+
+			/// @brief Used in place of a stateful_member_index when the members are
+			/// not hash indexed
+			struct no_stateful_member_index {
+				constexpr void clear( ) {}
+			};
+
+			/// @brief An open addressing hash index of the positions of seen members,
+			/// keyed on the hash of the member name.  The slots hold the position + 1
+			/// so that 0 can mark an empty slot.  Positions are only ever added in
+			/// document order, so the first of duplicate names is found first.
+			class stateful_member_index {
+				std::vector<std::size_t> m_slots{ };
+				std::size_t m_count = 0;
+
+				[[nodiscard]] static constexpr std::size_t
+				to_slot( daw::UInt32 hash ) {
+					return static_cast<std::size_t>( static_cast<std::uint32_t>( hash ) );
+				}
+
+				constexpr void insert_slot( daw::UInt32 hash, std::size_t pos ) {
+					std::size_t const mask = std::size( m_slots ) - 1U;
+					std::size_t idx = to_slot( hash ) & mask;
+					while( m_slots[idx] != 0 ) {
+						idx = ( idx + 1U ) & mask;
+					}
+					m_slots[idx] = pos + 1U;
+				}
+
+				template<typename Locations>
+				constexpr void grow( Locations const &locs ) {
+					auto old_slots = std::move( m_slots );
+					m_slots = std::vector<std::size_t>(
+					  std::empty( old_slots ) ? 16U : std::size( old_slots ) * 2U );
+					for( std::size_t slot : old_slots ) {
+						if( slot != 0 ) {
+							insert_slot( locs[slot - 1U].hash_value, slot - 1U );
+						}
+					}
+				}
+
+			public:
+				/// @brief Find the position of the first member matching name
+				/// @return The position in locs or the size of locs if not indexed
+				template<typename Locations>
+				[[nodiscard]] constexpr std::size_t find( Locations const &locs,
+				                                          daw::string_view name,
+				                                          daw::UInt32 hash ) const {
+					if( m_count == 0 ) {
+						return std::size( locs );
+					}
+					std::size_t const mask = std::size( m_slots ) - 1U;
+					std::size_t idx = to_slot( hash ) & mask;
+					while( m_slots[idx] != 0 ) {
+						std::size_t const pos = m_slots[idx] - 1U;
+						if( locs[pos].is_match( name, hash ) ) {
+							return pos;
+						}
+						idx = ( idx + 1U ) & mask;
+					}
+					return std::size( locs );
+				}
+
+				/// @brief Add the member at locs[pos] to the index.  The load factor
+				/// is kept at or below 1/2
+				template<typename Locations>
+				constexpr void insert( Locations const &locs, std::size_t pos ) {
+					if( ( m_count + 1U ) * 2U > std::size( m_slots ) ) {
+						grow( locs );
+					}
+					insert_slot( locs[pos].hash_value, pos );
+					++m_count;
+				}
+
+				/// @brief Remove all members, keeping the allocated slots for reuse
+				constexpr void clear( ) {
+					for( auto &slot : m_slots ) {
+						slot = 0;
+					}
+					m_count = 0;
+				}
+			};
 		} // namespace json_details
 
 		struct json_member_name {
@@ -74,9 +158,14 @@ namespace daw::json {
 		 * Maintains the parse positions of a json_value so that you pay the lookup
 		 * costs once
 		 * @tparam ParseState see IteratorRange
+		 * @tparam HashIndexMembers When true, the members seen are kept in a hash
+		 * index so that repeated lookups by name are O(1) instead of a linear
+		 * search of the members seen so far.  Use for large classes, such as
+		 * dictionaries, that are queried many times
 		 */
 		template<json_options_t PolicyFlags = json_details::default_policy_flag,
-		         typename Allocator = json_details::NoAllocator>
+		         typename Allocator = json_details::NoAllocator,
+		         bool HashIndexMembers = false>
 		class basic_stateful_json_value {
 			using ParseState =
 			  TryDefaultParsePolicy<BasicParsePolicy<PolicyFlags, Allocator>>;
@@ -85,6 +174,18 @@ namespace daw::json {
 			std::vector<
 			  json_details::basic_stateful_json_value_state<PolicyFlags, Allocator>>
 			  m_locs{ };
+			daw::conditional_t<HashIndexMembers,
+			                   json_details::stateful_member_index,
+			                   json_details::no_stateful_member_index>
+			  m_member_index{ };
+
+			constexpr void add_to_member_index( std::size_t pos ) {
+				if constexpr( HashIndexMembers ) {
+					m_member_index.insert( m_locs, pos );
+				} else {
+					(void)pos;
+				}
+			}
 
 			/***
 			 * Move parser until member name matches key if needed
@@ -94,10 +195,17 @@ namespace daw::json {
 			[[nodiscard]] constexpr std::size_t move_to( json_member_name member ) {
 				std::size_t pos = 0;
 				std::size_t const Sz = std::size( m_locs );
-				for( ; pos < Sz; ++pos ) {
-					if( m_locs[pos].is_match( member.name, member.hash_value ) ) {
+				if constexpr( HashIndexMembers ) {
+					pos = m_member_index.find( m_locs, member.name, member.hash_value );
+					if( pos < Sz ) {
 						return pos;
 					}
+				} else {
+					for( ; pos < Sz; ++pos ) {
+						if( m_locs[pos].is_match( member.name, member.hash_value ) ) {
+							return pos;
+						}
+					}
 				}
 
 				auto it = [&] {
@@ -114,6 +222,7 @@ namespace daw::json {
 					daw_json_assert_weak( name, ErrorReason::MissingMemberName );
 					auto const &new_loc = m_locs.emplace_back(
 					  daw::string_view( std::data( *name ), std::size( *name ) ), it );
+					add_to_member_index( pos );
 					if( new_loc.is_match( member.name ) ) {
 						return pos;
 					}
@@ -147,6 +256,7 @@ namespace daw::json {
 					if( name ) {
 						m_locs.emplace_back(
 						  daw::string_view( std::data( *name ), std::size( *name ) ), it );
+						add_to_member_index( pos );
 					} else {
 						m_locs.emplace_back( daw::string_view( ), it );
 					}
@@ -187,6 +297,7 @@ namespace daw::json {
 			constexpr void reset( basic_json_value<PolicyFlags, Allocator> val ) {
 				m_value = std::move( val );
 				m_locs.clear( );
+				m_member_index.clear( );
 			}
 
 			/// @brief Create a basic_json_member for the named member
@@ -391,5 +502,11 @@ namespace daw::json {
 		  -> basic_stateful_json_value<>;
 
 		using json_value_state = basic_stateful_json_value<>;
+
+		/// @brief A json_value_state with a hash index of the members seen, for
+		/// O(1) repeated lookups by name
+		using hashed_json_value_state =
+		  basic_stateful_json_value<json_details::default_policy_flag,
+		                            json_details::NoAllocator, true>;
 	} // namespace DAW_JSON_VER
 } // namespace daw::json
@@ -90,6 +90,17 @@ namespace daw::json {
 			NullVisible
 		};
 
+		///
+		/// @brief Control how fixed capacity string types handle strings longer
+		/// than their capacity
+		enum class FixedStringOverflow : unsigned {
+			/// @brief Parsing fails with ErrorReason::StringCapacityExceeded
+			Error,
+			/// @brief The string is truncated to the last whole UTF-8 code point that
+			/// fits
+			Truncate
+		};
+
 		/**
 		 * Tag lookup for parsing overload selection
 		 */
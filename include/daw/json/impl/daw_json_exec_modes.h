@@ -27,9 +27,17 @@ namespace daw::json {
 			static constexpr std::string_view name = "sse4.2";
 			static constexpr bool can_constexpr = false;
 		};
+		/// @brief sse42_exec_tag where json_input_padding bytes past the end of
+		/// the input can be read
+		struct sse42_padded_exec_tag : sse42_exec_tag {
+			static constexpr std::string_view name = "sse4.2 padded";
+			static constexpr bool can_constexpr = false;
+		};
 		using simd_exec_tag = sse42_exec_tag;
+		using simd_padded_exec_tag = sse42_padded_exec_tag;
 #else
 		struct simd_exec_tag : runtime_exec_tag {};
+		struct simd_padded_exec_tag : simd_exec_tag {};
 #endif
 		using default_exec_tag = constexpr_exec_tag;
 	} // namespace DAW_JSON_VER
@@ -11,8 +11,10 @@
 #include "version.h"
 
 #include "daw_json_assert.h"
+#include "daw_json_exec_modes.h"
 #include "daw_json_find_result.h"
 #include "daw_murmur3.h"
+#include "daw_not_const_ex_functions.h"
 
 #include <daw/algorithms/daw_algorithm_adjacent_find.h>
 #include <daw/daw_consteval.h>
@@ -25,6 +27,7 @@
 
 #include <cstddef>
 #include <daw/stdinc/data_access.h>
+#include <type_traits>
 
 #if defined( DAW_JSON_PARSER_DIAGNOSTICS )
 #include <cmath>
@@ -96,6 +99,48 @@ namespace daw::json {
 				}
 			};
 
+			/***
+			 * With the SSE4.2 exec mode, member names longer than 4 chars are hashed
+			 * with CRC32C using the crc32 instruction.  The tables built at compile
+			 * time use crc32c_name_hash, which gives the same result.  Other exec
+			 * modes use name_hash for both
+			 */
+			template<typename ParseState>
+			inline constexpr bool use_crc32c_name_hash_v =
+#if defined( DAW_ALLOW_SSE42 )
+			  std::is_base_of_v<sse42_exec_tag, typename ParseState::exec_tag_t>;
+#else
+			  false;
+#endif
+
+			/// @brief Hash of a mapped member name, for tables built at compile time
+			template<typename ParseState>
+			[[nodiscard]] DAW_ATTRIB_INLINE constexpr UInt32
+			table_name_hash( daw::string_view name ) {
+				if constexpr( use_crc32c_name_hash_v<ParseState> ) {
+					return crc32c_name_hash( name );
+				} else {
+					return name_hash<false>( name );
+				}
+			}
+
+			/// @brief Hash of a member name parsed from the document.  It is equal
+			/// to table_name_hash<ParseState> of the same name
+			template<typename ParseState>
+			[[nodiscard]] DAW_ATTRIB_INLINE constexpr UInt32
+			parsed_name_hash( daw::string_view name ) {
+#if defined( DAW_ALLOW_SSE42 )
+				if constexpr( use_crc32c_name_hash_v<ParseState> ) {
+					if( DAW_LIKELY( std::size( name ) <= sizeof( UInt32 ) ) ) {
+						return short_name_hash( name );
+					}
+					return to_uint32(
+					  crc32c( sse42_exec_tag{ }, std::data( name ), std::size( name ) ) );
+				}
+#endif
+				return name_hash<ParseState::expect_long_strings>( name );
+			}
+
 			/***
 			 * Contains an array of member location_info mapped in a json_class
 			 * @tparam MemberCount Number of mapped members from json_class
@@ -124,10 +169,10 @@ namespace daw::json {
 					return MemberCount;
 				}
 
-				template<bool expect_long_strings, std::size_t start_pos>
+				template<typename ParseState, std::size_t start_pos>
 				[[nodiscard]] DAW_ATTRIB_INLINE constexpr std::size_t
 				find_name( daw::string_view key ) const {
-					UInt32 const hash = name_hash<expect_long_strings>( key );
+					UInt32 const hash = parsed_name_hash<ParseState>( key );
 #if defined( DAW_JSON_BUGFIX_MSVC_EVAL_ORDER_002 )
 					(void)start_pos;
 					for( std::size_t n = 0; n < MemberCount; ++n ) {
@@ -147,11 +192,50 @@ namespace daw::json {
 				}
 			};
 
+			/***
+			 * The members of a class that were passed over while searching it,
+			 * e.g. for the tag member of a variant.  They can be seeded into the
+			 * locations of the class parser so that the class is only scanned
+			 * once.
+			 * @tparam CharT Character type of the document
+			 * @tparam Capacity Maximum number of members recorded.  When more are
+			 * seen, is_full is set and the recorded members are incomplete
+			 */
+			template<typename CharT, std::size_t Capacity = 16>
+			struct seen_class_members_t {
+				struct member_t {
+					daw::string_view name;
+					location_info_t<false, CharT> location;
+				};
+				member_t members[Capacity];
+				std::size_t size = 0;
+				bool is_full = false;
+
+				template<typename ParseState>
+				constexpr void push_back( daw::string_view name,
+				                          ParseState const &value ) {
+					if( size == Capacity ) {
+						is_full = true;
+						return;
+					}
+					members[size].name = name;
+					members[size].location.set_range( value );
+					++size;
+				}
+			};
+
+			/// @brief Used when the members passed over do not need recording
+			struct discard_seen_class_members_t {
+				template<typename ParseState>
+				constexpr void push_back( daw::string_view,
+				                          ParseState const & ) const noexcept {}
+			};
+
 			// Should never be called outside a consteval context
-			template<typename... MemberNames>
+			template<typename ParseState, typename... MemberNames>
 			static inline DAW_CONSTEVAL bool do_hashes_collide( ) {
 				daw::UInt32 hashes[sizeof...( MemberNames )]{
-				  name_hash<false>( MemberNames::name )... };
+				  table_name_hash<ParseState>( MemberNames::name )... };
 
 				daw::sort( std::data( hashes ), daw::data_end( hashes ) );
 				return daw::algorithm::adjacent_find(
@@ -170,24 +254,24 @@ namespace daw::json {
 				constexpr bool do_full_name_match = true;
 				return locations_info_t<sizeof...( JsonMembers ), CharT,
 				                        do_full_name_match>{
-				  { daw::name_hash<false>( JsonMembers::name )... },
+				  { table_name_hash<ParseState>( JsonMembers::name )... },
 				  { location_info_t<do_full_name_match, CharT>{
 				    JsonMembers::name }... } };
 #else
 				// DAW
 				constexpr bool do_full_name_match =
 				  ParseState::force_name_equal_check or
-				  do_hashes_collide<JsonMembers...>( );
+				  do_hashes_collide<ParseState, JsonMembers...>( );
 				if constexpr( do_full_name_match ) {
 					return locations_info_t<sizeof...( JsonMembers ), CharT,
 					                        do_full_name_match>{
-					  { daw::name_hash<false>( JsonMembers::name )... },
+					  { table_name_hash<ParseState>( JsonMembers::name )... },
 					  { location_info_t<do_full_name_match, CharT>{
 					    JsonMembers::name }... } };
 				} else {
 					return locations_info_t<sizeof...( JsonMembers ), CharT,
 					                        do_full_name_match>{
-					  { daw::name_hash<false>( JsonMembers::name )... }, {} };
+					  { table_name_hash<ParseState>( JsonMembers::name )... }, {} };
 				}
 #endif
 			}
@@ -229,8 +313,8 @@ namespace daw::json {
 					// parse_name checks if we have more and are quotes
 					auto const name = parse_name( parse_state );
 					auto const name_pos =
-					  locations.template find_name<ParseState::expect_long_strings,
-					                               ( from_start ? 0 : pos )>( name );
+					  locations.template find_name<ParseState, ( from_start ? 0 : pos )>(
+					    name );
 					if constexpr( must_exist == AllMembersMustExist::yes ) {
 						daw_json_assert_weak( name_pos < std::size( locations ),
 						                      ErrorReason::UnknownMember, parse_state );
@@ -292,6 +376,41 @@ namespace daw::json {
 					  locations[pos].template get_range<ParseState>( ), known };
 				}
 			}
+
+			/***
+			 * Copy the locations of members already seen into the locations of a
+			 * class parser.  Members that are not mapped are skipped, or are an
+			 * error when all members must exist.
+			 */
+			template<AllMembersMustExist must_exist, typename ParseState,
+			         std::size_t N, typename CharT, bool B, std::size_t Capacity>
+			DAW_ATTRIB_INLINE static constexpr void
+			seed_class_locations( ParseState const &parse_state,
+			                      locations_info_t<N, CharT, B> &locations,
+			                      seen_class_members_t<CharT, Capacity> const &seen ) {
+				(void)parse_state;
+				for( std::size_t n = 0; n < seen.size; ++n ) {
+					auto const &member = seen.members[n];
+					auto const name_pos =
+					  locations.template find_name<ParseState, 0>( member.name );
+					if constexpr( must_exist == AllMembersMustExist::yes ) {
+						daw_json_assert_weak( name_pos < std::size( locations ),
+						                      ErrorReason::UnknownMember, parse_state );
+					}
+					if( name_pos >= std::size( locations ) ) {
+						// This is not a member we are concerned with
+						continue;
+					}
+					auto &loc = locations[name_pos];
+					if( loc.missing( ) ) {
+						loc.first = member.location.first;
+						loc.last = member.location.last;
+						loc.class_first = member.location.class_first;
+						loc.class_last = member.location.class_last;
+						loc.counter = member.location.counter;
+					}
+				}
+			}
 		} // namespace json_details
 	} // namespace DAW_JSON_VER
 } // namespace daw::json
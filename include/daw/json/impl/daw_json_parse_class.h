@@ -172,6 +172,97 @@ namespace daw::json {
 				parse_state.set_class_position( old_class_pos );
 			}
 
+			///
+			/// @brief Parse the members of a class and construct it.  The
+			/// parse_state is at the first member not yet seen, after the opening
+			/// brace, and known_locations has the locations of members already
+			/// seen.
+			///
+			template<typename JsonClass, typename... JsonMembers, typename ParseState,
+			         typename OldClassPos, typename KnownLocations, std::size_t... Is>
+			[[nodiscard]] DAW_ATTRIB_INLINE constexpr json_result_t<JsonClass>
+			parse_json_class_members( ParseState &parse_state,
+			                          OldClassPos const &old_class_pos,
+			                          KnownLocations &known_locations,
+			                          std::index_sequence<Is...> ) {
+				using T = json_result_t<JsonClass>;
+				using Constructor = json_constructor_t<JsonClass>;
+				using must_exist =
+				  daw::constant<( all_json_members_must_exist_v<T, ParseState>
+				                    ? AllMembersMustExist::yes
+				                    : AllMembersMustExist::no )>;
+				using NeedClassPositions = std::bool_constant<(
+				  ( must_be_class_member_v<typename JsonMembers::without_name> or
+				    ... ) )>;
+
+				if constexpr( is_pinned_type_v<json_result_t<JsonClass>> ) {
+					/// Because the return type is pinned(no copy/move).  We cannot rely
+					/// on NRVO. This requires on_exit_success that on some platforms
+					/// can cost a bunch because it checks std::uncaught_exceptions
+					auto const run_after_parse = daw::on_exit_success( [&] {
+						class_cleanup_now<all_json_members_must_exist_v<T, ParseState>>(
+						  parse_state, old_class_pos );
+					} );
+					(void)run_after_parse;
+
+					if constexpr( should_construct_explicitly_v<Constructor, T,
+					                                            ParseState> ) {
+						return T{ parse_class_member<
+						  Is, daw::traits::nth_type<Is, JsonMembers...>, must_exist::value,
+						  NeedClassPositions::value>( parse_state, known_locations )... };
+					} else {
+						return construct_value_tp<T, Constructor>(
+						  parse_state, fwd_pack{ parse_class_member<
+						                 Is, daw::traits::nth_type<Is, JsonMembers...>,
+						                 must_exist::value, NeedClassPositions::value>(
+						                 parse_state, known_locations )... } );
+					}
+				} else {
+					if constexpr( should_construct_explicitly_v<Constructor, T,
+					                                            ParseState> ) {
+						auto result = T{ parse_class_member<
+						  Is, daw::traits::nth_type<Is, JsonMembers...>, must_exist::value,
+						  NeedClassPositions::value>( parse_state, known_locations )... };
+
+						class_cleanup_now<all_json_members_must_exist_v<T, ParseState>>(
+						  parse_state, old_class_pos );
+						return result;
+					} else {
+						auto result = construct_value_tp<T, Constructor>(
+						  parse_state, fwd_pack{ parse_class_member<
+						                 Is, daw::traits::nth_type<Is, JsonMembers...>,
+						                 must_exist::value, NeedClassPositions::value>(
+						                 parse_state, known_locations )... } );
+
+						class_cleanup_now<all_json_members_must_exist_v<T, ParseState>>(
+						  parse_state, old_class_pos );
+						return result;
+					}
+				}
+			}
+
+			///
+			/// @brief Construct a class without members and move past it
+			///
+			template<typename JsonClass, typename ParseState, typename OldClassPos>
+			[[nodiscard]] DAW_ATTRIB_INLINE constexpr json_result_t<JsonClass>
+			parse_json_empty_class( ParseState &parse_state,
+			                        OldClassPos const &old_class_pos ) {
+				using T = json_result_t<JsonClass>;
+				using Constructor = json_constructor_t<JsonClass>;
+				// Clang-CL with MSVC has issues if we don't do empties this way
+				class_cleanup_now<all_json_members_must_exist_v<T, ParseState>>(
+				  parse_state, old_class_pos );
+
+				if constexpr( should_construct_explicitly_v<Constructor, T,
+				                                            ParseState> ) {
+					return T{ };
+				} else {
+					return construct_value_tp<T, Constructor>( parse_state,
+					                                           fwd_pack{ } );
+				}
+			}
+
 			///
 			/// @brief Parse to the user supplied class.  The parser will run
 			/// left->right if it can when the JSON document's order matches that of
@@ -185,12 +276,7 @@ namespace daw::json {
 			parse_json_class( ParseState &parse_state, std::index_sequence<Is...> ) {
 				static_assert( is_a_json_type_v<JsonClass> );
 				using T = json_result_t<JsonClass>;
-				using Constructor = json_constructor_t<JsonClass>;
 				static_assert( has_json_data_contract_trait_v<T>, "Unexpected type" );
-				using must_exist =
-				  daw::constant<( all_json_members_must_exist_v<T, ParseState>
-				                    ? AllMembersMustExist::yes
-				                    : AllMembersMustExist::no )>;
 
 				parse_state.trim_left( );
 				// TODO, use member name
@@ -203,22 +289,9 @@ namespace daw::json {
 				parse_state.trim_left( );
 
 				if constexpr( sizeof...( JsonMembers ) == 0 ) {
-					// Clang-CL with MSVC has issues if we don't do empties this way
-					class_cleanup_now<all_json_members_must_exist_v<T, ParseState>>(
-					  parse_state, old_class_pos );
-
-					if constexpr( should_construct_explicitly_v<Constructor, T,
-					                                            ParseState> ) {
-						return T{ };
-					} else {
-						return construct_value_tp<T, Constructor>( parse_state,
-						                                           fwd_pack{ } );
-					}
+					return parse_json_empty_class<JsonClass>( parse_state,
+					                                          old_class_pos );
 				} else {
-					using NeedClassPositions = std::bool_constant<(
-					  ( must_be_class_member_v<typename JsonMembers::without_name> or
-					    ... ) )>;
-
 #if defined( DAW_JSON_BUGFIX_MSVC_KNOWN_LOC_ICE_003 )
 					auto known_locations =
 					  make_locations_info<ParseState, JsonMembers...>( );
@@ -226,53 +299,56 @@ namespace daw::json {
 					auto known_locations = DAW_AS_CONSTANT(
 					  ( make_locations_info<ParseState, JsonMembers...>( ) ) );
 #endif
+					return parse_json_class_members<JsonClass, JsonMembers...>(
+					  parse_state, old_class_pos, known_locations,
+					  std::index_sequence<Is...>{ } );
+				}
+			}
 
-					if constexpr( is_pinned_type_v<json_result_t<JsonClass>> ) {
-						/// Because the return type is pinned(no copy/move).  We cannot rely
-						/// on NRVO. This requires on_exit_success that on some platforms
-						/// can cost a bunch because it checks std::uncaught_exceptions
-						auto const run_after_parse = daw::on_exit_success( [&] {
-							class_cleanup_now<all_json_members_must_exist_v<T, ParseState>>(
-							  parse_state, old_class_pos );
-						} );
-						(void)run_after_parse;
-
-						if constexpr( should_construct_explicitly_v<Constructor, T,
-						                                            ParseState> ) {
-							return T{ parse_class_member<
-							  Is, daw::traits::nth_type<Is, JsonMembers...>,
-							  must_exist::value, NeedClassPositions::value>(
-							  parse_state, known_locations )... };
-						} else {
-							return construct_value_tp<T, Constructor>(
-							  parse_state, fwd_pack{ parse_class_member<
-							                 Is, daw::traits::nth_type<Is, JsonMembers...>,
-							                 must_exist::value, NeedClassPositions::value>(
-							                 parse_state, known_locations )... } );
-						}
-					} else {
-						if constexpr( should_construct_explicitly_v<Constructor, T,
-						                                            ParseState> ) {
-							auto result = T{ parse_class_member<
-							  Is, daw::traits::nth_type<Is, JsonMembers...>,
-							  must_exist::value, NeedClassPositions::value>(
-							  parse_state, known_locations )... };
+			///
+			/// @brief Parse to the user supplied class after some of its members were
+			/// already passed over, e.g. when searching for the tag of a variant.
+			/// The seen members are seeded into the member locations and parsing
+			/// continues from the current position, so the class is only scanned
+			/// once.
+			/// @param parse_state At the first member not seen, with the class
+			/// position set to the class
+			/// @param old_class_pos The class position to restore after parsing
+			/// @param seen The members already passed over
+			///
+			template<typename JsonClass, typename... JsonMembers, typename ParseState,
+			         typename OldClassPos, typename SeenMembers, std::size_t... Is>
+			[[nodiscard]] DAW_ATTRIB_INLINE constexpr json_result_t<JsonClass>
+			parse_json_class_seeded( ParseState &parse_state,
+			                         OldClassPos const &old_class_pos,
+			                         SeenMembers const &seen,
+			                         std::index_sequence<Is...> ) {
+				static_assert( is_a_json_type_v<JsonClass> );
+				using T = json_result_t<JsonClass>;
+				static_assert( has_json_data_contract_trait_v<T>, "Unexpected type" );
 
-							class_cleanup_now<all_json_members_must_exist_v<T, ParseState>>(
-							  parse_state, old_class_pos );
-							return result;
-						} else {
-							auto result = construct_value_tp<T, Constructor>(
-							  parse_state, fwd_pack{ parse_class_member<
-							                 Is, daw::traits::nth_type<Is, JsonMembers...>,
-							                 must_exist::value, NeedClassPositions::value>(
-							                 parse_state, known_locations )... } );
-
-							class_cleanup_now<all_json_members_must_exist_v<T, ParseState>>(
-							  parse_state, old_class_pos );
-							return result;
-						}
+				if constexpr( sizeof...( JsonMembers ) == 0 ) {
+					if constexpr( all_json_members_must_exist_v<T, ParseState> ) {
+						daw_json_assert_weak( seen.size == 0, ErrorReason::UnknownMember,
+						                      parse_state );
 					}
+					return parse_json_empty_class<JsonClass>( parse_state,
+					                                          old_class_pos );
+				} else {
+#if defined( DAW_JSON_BUGFIX_MSVC_KNOWN_LOC_ICE_003 )
+					auto known_locations =
+					  make_locations_info<ParseState, JsonMembers...>( );
+#else
+					auto known_locations = DAW_AS_CONSTANT(
+					  ( make_locations_info<ParseState, JsonMembers...>( ) ) );
+#endif
+					seed_class_locations<( all_json_members_must_exist_v<T, ParseState>
+					                         ? AllMembersMustExist::yes
+					                         : AllMembersMustExist::no )>(
+					  parse_state, known_locations, seen );
+					return parse_json_class_members<JsonClass, JsonMembers...>(
+					  parse_state, old_class_pos, known_locations,
+					  std::index_sequence<Is...>{ } );
 				}
 			}
 
@@ -158,13 +158,22 @@ namespace daw::json {
 			  default_json_option_value<options::ExcludeSpecialEscapes> =
 			    options::ExcludeSpecialEscapes::no;
 
+			template<>
+			inline constexpr unsigned json_option_bits_width<options::PaddedInput> =
+			  1;
+
+			template<>
+			inline constexpr auto default_json_option_value<options::PaddedInput> =
+			  options::PaddedInput::no;
+
 			using policy_list = typename option_list_impl<
 			  options::ExecModeTypes, options::ZeroTerminatedString,
 			  options::PolicyCommentTypes, options::CheckedParseMode,
 			  options::AllowEscapedNames, options::IEEE754Precise,
 			  options::ForceFullNameCheck, options::MinifiedDocument,
 			  options::UseExactMappingsByDefault, options::MustVerifyEndOfDataIsValid,
-			  options::ExcludeSpecialEscapes, options::ExpectLongNames>::type;
+			  options::ExcludeSpecialEscapes, options::ExpectLongNames,
+			  options::PaddedInput>::type;
 
 			template<typename Policy, typename Policies>
 			inline constexpr unsigned basic_policy_bits_start =
@@ -66,12 +66,22 @@ namespace daw::json {
 			  options::CheckedParseMode::no;
 
 			/***
-			 * See options::ExecModeTypes
+			 * See options::PaddedInput
+			 */
+			static constexpr bool is_padded_input =
+			  json_details::get_bits_for<options::PaddedInput>( PolicyFlags ) ==
+			  options::PaddedInput::yes;
+
+			/***
+			 * See options::ExecModeTypes.  Padded input selects the simd kernels
+			 * that do not handle the tail of the input separately
 			 */
 			using exec_tag_t =
 			  switch_t<json_details::get_bits_for<options::ExecModeTypes,
 			                                      std::size_t>( PolicyFlags ),
-			           constexpr_exec_tag, runtime_exec_tag, simd_exec_tag>;
+			           constexpr_exec_tag, runtime_exec_tag,
+			           daw::conditional_t<is_padded_input, simd_padded_exec_tag,
+			                              simd_exec_tag>>;
 
 			static constexpr exec_tag_t exec_tag = exec_tag_t{ };
 
@@ -10,6 +10,7 @@
 
 #include "version.h"
 
+#include "daw/json/daw_json_default_constuctor_fwd.h"
 #include "daw/json/daw_json_switches.h"
 #include "daw_json_assert.h"
 #include "daw_json_parse_common.h"
@@ -23,6 +24,7 @@
 #include <cstddef>
 #include <daw/stdinc/data_access.h>
 #include <daw/stdinc/range_access.h>
+#include <string>
 #include <type_traits>
 
 namespace daw::json {
@@ -197,18 +199,75 @@ namespace daw::json {
 				inline constexpr char const escape_quotes[] = "\\\"";
 			}
 
-			// Fast path for parsing escaped strings to a std::string with the default
-			// appender
-			template<bool AllowHighEight, typename JsonMember, bool KnownBounds,
-			         typename ParseState>
-			[[nodiscard]] static constexpr auto
-			parse_string_known_stdstring( ParseState &parse_state ) {
-				using string_type = json_base_type_t<JsonMember>;
-				string_type result =
-				  string_type( std::size( parse_state ) + 1, '\0',
-				               parse_state.template get_allocator_for<char>( ) );
-				char *it = std::data( result );
+			/// @brief Decode the escape at the front of parse_state, after the
+			/// backslash, to it
+			/// @return The end of the decoded characters, at most 4 past it
+			template<bool AllowHighEight, typename ParseState>
+			DAW_ATTRIB_NONNULL( )
+			DAW_ATTRIB_RET_NONNULL [[nodiscard]] static constexpr char *decode_escape(
+			  ParseState &parse_state, char *it ) {
+				daw_json_assert_weak( not parse_state.is_space_unchecked( ),
+				                      ErrorReason::InvalidUTFCodepoint, parse_state );
+				switch( parse_state.front( ) ) {
+				case 'b':
+					*it++ = '\b';
+					parse_state.remove_prefix( );
+					break;
+				case 'f':
+					*it++ = '\f';
+					parse_state.remove_prefix( );
+					break;
+				case 'n':
+					*it++ = '\n';
+					parse_state.remove_prefix( );
+					break;
+				case 'r':
+					*it++ = '\r';
+					parse_state.remove_prefix( );
+					break;
+				case 't':
+					*it++ = '\t';
+					parse_state.remove_prefix( );
+					break;
+				case 'u':
+					it = decode_utf16( parse_state, it );
+					break;
+				case '/':
+				case '\\':
+				case '"':
+					*it++ = parse_state.front( );
+					parse_state.remove_prefix( );
+					break;
+				default:
+					if constexpr( not AllowHighEight ) {
+						daw_json_assert_weak(
+						  ( not parse_state.is_space_unchecked( ) ) &
+						    ( static_cast<unsigned char>( parse_state.front( ) ) <=
+						      0x7FU ),
+						  ErrorReason::InvalidStringHighASCII, parse_state );
+					}
+					*it++ = parse_state.front( );
+					parse_state.remove_prefix( );
+				}
+				return it;
+			}
 
+			struct unescape_result_t {
+				char *last;
+				bool is_truncated;
+			};
+
+			/// @brief Unescape the string in parse_state to the output range
+			/// [it, out_last).  The unescaped string is never longer than the escaped
+			/// one.
+			/// @tparam IsBounded When false, the output range must be at least
+			/// std::size( parse_state ) long.  When true, unescaping stops before the
+			/// output range would be exceeded and is_truncated is set
+			template<bool AllowHighEight, bool KnownBounds, bool IsBounded,
+			         typename ParseState>
+			[[nodiscard]] static constexpr unescape_result_t
+			unescape_string_to( ParseState &parse_state, char *it,
+			                    char *const out_last ) {
 				bool const has_quote = parse_state.front( ) == '"';
 				if( has_quote ) {
 					parse_state.remove_prefix( );
@@ -217,6 +276,15 @@ namespace daw::json {
 				if( auto const first_slash =
 				      static_cast<std::ptrdiff_t>( parse_state.counter ) - 1;
 				    first_slash > 1 ) {
+					if constexpr( IsBounded ) {
+						if( first_slash > out_last - it ) {
+							it = daw::algorithm::copy_n( parse_state.first, it,
+							                             static_cast<std::size_t>(
+							                               out_last - it ) )
+							       .output;
+							return { it, true };
+						}
+					}
 					it = daw::algorithm::copy_n( parse_state.first, it,
 					                             static_cast<std::size_t>( first_slash ) )
 					       .output;
@@ -254,59 +322,34 @@ namespace daw::json {
 							                      '"', '\\'>( ParseState::exec_tag, first,
 							                                  last );
 						}
-						daw_json_assert_weak(
-						  static_cast<std::ptrdiff_t>( result.size( ) ) -
-						      std::distance( result.data( ), it ) >=
-						    std::distance( parse_state.first, first ),
-						  ErrorReason::UnexpectedEndOfData );
+						if constexpr( IsBounded ) {
+							if( std::distance( parse_state.first, first ) > out_last - it ) {
+								it = daw::algorithm::copy_n(
+								       parse_state.first, it,
+								       static_cast<std::size_t>( out_last - it ) )
+								       .output;
+								return { it, true };
+							}
+						} else {
+							daw_json_assert_weak( out_last - it >=
+							                        std::distance( parse_state.first, first ),
+							                      ErrorReason::UnexpectedEndOfData );
+						}
 						it = daw::algorithm::copy( parse_state.first, first, it );
 						parse_state.first = first;
 					}
 					if( parse_state.front( ) == '\\' ) {
 						parse_state.remove_prefix( );
-						daw_json_assert_weak( not parse_state.is_space_unchecked( ),
-						                      ErrorReason::InvalidUTFCodepoint,
-						                      parse_state );
-						switch( parse_state.front( ) ) {
-						case 'b':
-							*it++ = '\b';
-							parse_state.remove_prefix( );
-							break;
-						case 'f':
-							*it++ = '\f';
-							parse_state.remove_prefix( );
-							break;
-						case 'n':
-							*it++ = '\n';
-							parse_state.remove_prefix( );
-							break;
-						case 'r':
-							*it++ = '\r';
-							parse_state.remove_prefix( );
-							break;
-						case 't':
-							*it++ = '\t';
-							parse_state.remove_prefix( );
-							break;
-						case 'u':
-							it = decode_utf16( parse_state, it );
-							break;
-						case '/':
-						case '\\':
-						case '"':
-							*it++ = parse_state.front( );
-							parse_state.remove_prefix( );
-							break;
-						default:
-							if constexpr( not AllowHighEight ) {
-								daw_json_assert_weak(
-								  ( not parse_state.is_space_unchecked( ) ) &
-								    ( static_cast<unsigned char>( parse_state.front( ) ) <=
-								      0x7FU ),
-								  ErrorReason::InvalidStringHighASCII, parse_state );
+						if constexpr( IsBounded ) {
+							char buff[4]{ };
+							char *const buff_last =
+							  decode_escape<AllowHighEight>( parse_state, buff );
+							if( buff_last - buff > out_last - it ) {
+								return { it, true };
 							}
-							*it++ = parse_state.front( );
-							parse_state.remove_prefix( );
+							it = daw::algorithm::copy( buff, buff_last, it );
+						} else {
+							it = decode_escape<AllowHighEight>( parse_state, it );
 						}
 					} else {
 						daw_json_assert_weak( not has_quote or
@@ -316,20 +359,117 @@ namespace daw::json {
 					daw_json_assert_weak( not has_quote or parse_state.has_more( ),
 					                      ErrorReason::UnexpectedEndOfData, parse_state );
 				}
+				return { it, false };
+			}
+
+			/// @brief The end of the longest prefix of [first, last) that does not
+			/// end in a partial UTF-8 code point
+			DAW_ATTRIB_NONNULL( )
+			[[nodiscard]] static constexpr char *utf8_truncate( char *first,
+			                                                    char *last ) {
+				auto pos = last;
+				// Find the start of the last code point
+				while( pos != first and
+				       ( static_cast<unsigned char>( *( pos - 1 ) ) & 0xC0U ) ==
+				         0x80U ) {
+					--pos;
+				}
+				if( pos == first ) {
+					return last;
+				}
+				--pos;
+				auto const lead = static_cast<unsigned char>( *pos );
+				std::ptrdiff_t const cp_size = lead < 0x80U   ? 1
+				                               : lead >= 0xF0U ? 4
+				                               : lead >= 0xE0U ? 3
+				                               : lead >= 0xC0U ? 2
+				                                               : 1;
+				if( last - pos < cp_size ) {
+					return pos;
+				}
+				return last;
+			}
+
+			// Fast path for parsing escaped strings to a std::string with the default
+			// appender
+			template<bool AllowHighEight, typename JsonMember, bool KnownBounds,
+			         typename ParseState>
+			[[nodiscard]] static constexpr auto
+			parse_string_known_stdstring( ParseState &parse_state ) {
+				using base_type = json_base_type_t<JsonMember>;
+				// Types that cannot be presized, e.g. views made by the constructor,
+				// are unescaped into a temporary std::string first
+				using string_type = daw::conditional_t<
+				  std::is_constructible_v<
+				    base_type, std::size_t, char,
+				    decltype( parse_state.template get_allocator_for<char>( ) )>,
+				  base_type, std::string>;
+				string_type result = [&] {
+					if constexpr( std::is_same_v<string_type, base_type> ) {
+						return string_type(
+						  std::size( parse_state ) + 1, '\0',
+						  parse_state.template get_allocator_for<char>( ) );
+					} else {
+						return string_type( std::size( parse_state ) + 1, '\0' );
+					}
+				}( );
+				char *const it =
+				  unescape_string_to<AllowHighEight, KnownBounds, false>(
+				    parse_state, std::data( result ), daw::data_end( result ) )
+				    .last;
 				auto const sz =
 				  static_cast<std::size_t>( std::distance( std::data( result ), it ) );
 				daw_json_assert_weak( std::size( result ) >= sz,
 				                      ErrorReason::InvalidString, parse_state );
 				result.resize( sz );
-				if constexpr( std::is_convertible_v<string_type,
+				using constructor_t = json_constructor_t<JsonMember>;
+				if constexpr( std::is_same_v<string_type, base_type> and
+				              std::is_same_v<constructor_t,
+				                             default_constructor<base_type>> and
+				              std::is_convertible_v<string_type,
 				                                    json_result_t<JsonMember>> ) {
 					return result;
 				} else {
-					using constructor_t = json_constructor_t<JsonMember>;
-					construct_value<json_result_t<JsonMember>, constructor_t>(
+					return construct_value<json_result_t<JsonMember>, constructor_t>(
 					  parse_state, std::data( result ), daw::data_end( result ) );
 				}
 			}
+
+			/// @brief Parse an escaped string directly into the storage of a fixed
+			/// capacity string, applying its overflow policy
+			template<bool AllowHighEight, typename JsonMember, bool KnownBounds,
+			         typename ParseState>
+			[[nodiscard]] static constexpr auto
+			parse_string_known_fixed_capacity( ParseState &parse_state ) {
+				using string_type = json_base_type_t<JsonMember>;
+				auto result = string_type( );
+				char *const first = std::data( result );
+				auto const unescaped =
+				  unescape_string_to<AllowHighEight, KnownBounds, true>(
+				    parse_state, first, first + string_type::fixed_capacity );
+				char *last = unescaped.last;
+				if( unescaped.is_truncated ) {
+					if constexpr( string_type::overflow_policy ==
+					              FixedStringOverflow::Error ) {
+						daw_json_error( ErrorReason::StringCapacityExceeded, parse_state );
+					} else {
+						last = utf8_truncate( first, last );
+					}
+				}
+				// The chars are already written, resize( ) would zero them
+				result.set_size( static_cast<std::size_t>( last - first ) );
+				using constructor_t = json_constructor_t<JsonMember>;
+				if constexpr( std::is_same_v<constructor_t,
+				                             default_constructor<string_type>> and
+				              std::is_convertible_v<string_type,
+				                                    json_result_t<JsonMember>> ) {
+					return result;
+				} else {
+					return construct_value<json_result_t<JsonMember>, constructor_t>(
+					  parse_state, std::data( result ),
+					  std::data( result ) + result.size( ) );
+				}
+			}
 		} // namespace json_details
 	} // namespace DAW_JSON_VER
 } // namespace daw::json
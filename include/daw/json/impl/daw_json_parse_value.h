@@ -11,6 +11,7 @@
 #include "version.h"
 
 #include "daw_json_assert.h"
+#include "daw_json_location_info.h"
 #include "daw_json_parse_array_iterator.h"
 #include "daw_json_parse_kv_array_iterator.h"
 #include "daw_json_parse_kv_class_iterator.h"
@@ -511,9 +512,15 @@ namespace daw::json {
 					if( not AllowHighEightbits::value or
 					    needs_slow_path( parse_state2 ) ) {
 						// There are escapes in the string
-						return parse_string_known_stdstring<AllowHighEightbits::value,
-						                                    JsonMember, true>(
-						  parse_state2 );
+						if constexpr( is_fixed_capacity_string_v<
+						                json_base_type_t<JsonMember>> ) {
+							return parse_string_known_fixed_capacity<
+							  AllowHighEightbits::value, JsonMember, true>( parse_state2 );
+						} else {
+							return parse_string_known_stdstring<AllowHighEightbits::value,
+							                                    JsonMember, true>(
+							  parse_state2 );
+						}
 					}
 					// There are no escapes in the string, we can just use the ptr/size
 					// ctor
@@ -610,6 +617,12 @@ namespace daw::json {
 				}
 			}
 
+			/// @brief Constructors of key_value containers that accept the number
+			/// of members after the iterators, e.g. to size a hash table once
+			DAW_JSON_MAKE_REQ_TYPE_ALIAS_TRAIT(
+			  is_sized_key_value_constructor_v,
+			  T::i_am_a_sized_key_value_constructor );
+
 			/**
 			 * Parse a key_value pair encoded as a json object where the keys are
 			 * the member names
@@ -628,16 +641,32 @@ namespace daw::json {
 				                      ErrorReason::ExpectedKeyValueToStartWithBrace,
 				                      parse_state );
 
-				parse_state.remove_prefix( );
-				parse_state.trim_left( );
-
+				using constructor_t = json_constructor_t<JsonMember>;
 				using iter_t =
 				  json_parse_kv_class_iterator<JsonMember, ParseState,
 				                               can_be_random_iterator_v<KnownBounds>>;
 
-				using constructor_t = json_constructor_t<JsonMember>;
-				return construct_value<json_result_t<JsonMember>, constructor_t>(
-				  parse_state, iter_t( parse_state ), iter_t( ) );
+				if constexpr( is_sized_key_value_constructor_v<constructor_t> ) {
+					// The counter is the number of commas between the members
+					auto const size_hint = [&]( ) -> std::size_t {
+						if constexpr( KnownBounds ) {
+							return parse_state.counter + 1;
+						} else {
+							// Count the members first so the container is only sized once
+							auto counting_state = parse_state;
+							return counting_state.skip_class( ).counter + 1;
+						}
+					}( );
+					parse_state.remove_prefix( );
+					parse_state.trim_left( );
+					return construct_value<json_result_t<JsonMember>, constructor_t>(
+					  parse_state, iter_t( parse_state ), iter_t( ), size_hint );
+				} else {
+					parse_state.remove_prefix( );
+					parse_state.trim_left( );
+					return construct_value<json_result_t<JsonMember>, constructor_t>(
+					  parse_state, iter_t( parse_state ), iter_t( ) );
+				}
 			}
 
 			/**
@@ -726,66 +755,121 @@ namespace daw::json {
 				  static_cast<std::size_t>( sz ) );
 			}
 
-			template<JsonBaseParseTypes BPT, typename JsonMembers, bool KnownBounds,
+			/// @brief A lookup from the first byte of a JSON value to the alternative
+			/// of an untagged variant that parses it
+			struct variant_first_byte_table_t {
+				/// The byte cannot start a JSON value
+				static constexpr std::uint8_t invalid_start = 0xFFU;
+				/// The byte can start a JSON value but the variant has no alternative
+				/// for its type
+				static constexpr std::uint8_t no_alternative = 0xFEU;
+
+				std::uint8_t values[256] = { };
+
+				[[nodiscard]] constexpr std::uint8_t operator[]( char c ) const {
+					return values[static_cast<unsigned char>( c )];
+				}
+			};
+
+			template<typename JsonMember>
+			inline constexpr variant_first_byte_table_t variant_first_byte_table =
+			  [] {
+				  using element_map_t =
+				    typename JsonMember::json_elements::element_map_t;
+				  auto result = variant_first_byte_table_t{ };
+				  for( auto &value : result.values ) {
+					  value = variant_first_byte_table_t::invalid_start;
+				  }
+				  auto const set_bytes = [&]( JsonBaseParseTypes bpt,
+				                              char const *first_bytes ) {
+					  auto const idx = JsonMember::base_map::base_map
+					    [static_cast<std::int_fast8_t>( bpt )];
+					  auto const value =
+					    idx < pack_size_v<element_map_t>
+					      ? static_cast<std::uint8_t>( idx )
+					      : variant_first_byte_table_t::no_alternative;
+					  for( ; *first_bytes != '\0'; ++first_bytes ) {
+						  result.values[static_cast<unsigned char>( *first_bytes )] =
+						    value;
+					  }
+				  };
+				  set_bytes( JsonBaseParseTypes::Class, "{" );
+				  set_bytes( JsonBaseParseTypes::Array, "[" );
+				  set_bytes( JsonBaseParseTypes::Bool, "tf" );
+				  set_bytes( JsonBaseParseTypes::String, "\"" );
+				  set_bytes( JsonBaseParseTypes::Number, "0123456789+-" );
+				  return result;
+			  }( );
+
+			/// @brief Parse the alternative pos of an untagged variant.  pos past
+			/// the last alternative is never reached
+			template<typename JsonMember, bool KnownBounds, std::size_t pos,
 			         typename ParseState>
-			[[nodiscard]] DAW_ATTRIB_FLATINLINE static constexpr json_result_t<
-			  JsonMembers>
-			parse_variant_value( ParseState &parse_state ) {
-				using element_t = typename JsonMembers::json_elements;
-				using idx = daw::constant<( JsonMembers::base_map::base_map
-				                              [static_cast<std::int_fast8_t>( BPT )] )>;
-
-				if constexpr( idx::value <
-				              pack_size_v<typename element_t::element_map_t> ) {
-					using JsonMember =
-					  pack_element_t<idx::value, typename element_t::element_map_t>;
-					return parse_value<JsonMember, KnownBounds,
-					                   JsonMember::expected_type>( parse_state );
+			[[nodiscard]] DAW_ATTRIB_INLINE static constexpr json_result_t<JsonMember>
+			parse_variant_alternative( ParseState &parse_state ) {
+				using element_map_t = typename JsonMember::json_elements::element_map_t;
+				if constexpr( pos < pack_size_v<element_map_t> ) {
+					using alternative_t = pack_element_t<pos, element_map_t>;
+					return parse_value<alternative_t, KnownBounds,
+					                   alternative_t::expected_type>( parse_state );
 				} else {
-					daw_json_error( ErrorReason::UnexpectedJSONVariantType );
+					(void)parse_state;
+					DAW_UNREACHABLE( );
 				}
 			}
 
 			template<typename JsonMember, bool KnownBounds, typename ParseState>
 			[[nodiscard]] static constexpr json_result_t<JsonMember>
 			parse_value_variant( ParseState &parse_state ) {
-				if constexpr( KnownBounds ) {
-					// We are only in this branch when a member has been skipped.  This
-					// means we can look backwards
-					if( *( parse_state.first - 1 ) == '"' ) {
-						// We are a string, the skipper trims them
-						return parse_variant_value<JsonBaseParseTypes::String, JsonMember,
-						                           KnownBounds>( parse_state );
+				using element_map_t = typename JsonMember::json_elements::element_map_t;
+				using table_t = variant_first_byte_table_t;
+				constexpr auto const &table = variant_first_byte_table<JsonMember>;
+
+				std::uint8_t const idx = [&] {
+					if constexpr( KnownBounds ) {
+						// We are only in this branch when a member has been skipped.  This
+						// means we can look backwards
+						if( *( parse_state.first - 1 ) == '"' ) {
+							// We are a string, the skipper trims them
+							return table['"'];
+						}
+					}
+					return table[parse_state.front( )];
+				}( );
+
+				// An untagged variant has at most one alternative for each
+				// JsonBaseParseTypes
+				static_assert( pack_size_v<element_map_t> <= 7,
+				               "Too many alternatives for an untagged variant" );
+				if constexpr( pack_size_v<element_map_t> > 0 ) {
+					if( DAW_LIKELY( idx < pack_size_v<element_map_t> ) ) {
+						switch( idx ) {
+						case 0:
+							return parse_variant_alternative<JsonMember, KnownBounds, 0>(
+							  parse_state );
+						case 1:
+							return parse_variant_alternative<JsonMember, KnownBounds, 1>(
+							  parse_state );
+						case 2:
+							return parse_variant_alternative<JsonMember, KnownBounds, 2>(
+							  parse_state );
+						case 3:
+							return parse_variant_alternative<JsonMember, KnownBounds, 3>(
+							  parse_state );
+						case 4:
+							return parse_variant_alternative<JsonMember, KnownBounds, 4>(
+							  parse_state );
+						case 5:
+							return parse_variant_alternative<JsonMember, KnownBounds, 5>(
+							  parse_state );
+						default:
+							return parse_variant_alternative<JsonMember, KnownBounds, 6>(
+							  parse_state );
+						}
 					}
 				}
-				switch( parse_state.front( ) ) {
-				case '{':
-					return parse_variant_value<JsonBaseParseTypes::Class, JsonMember,
-					                           KnownBounds>( parse_state );
-				case '[':
-					return parse_variant_value<JsonBaseParseTypes::Array, JsonMember,
-					                           KnownBounds>( parse_state );
-				case 't':
-				case 'f':
-					return parse_variant_value<JsonBaseParseTypes::Bool, JsonMember,
-					                           KnownBounds>( parse_state );
-				case '"':
-					return parse_variant_value<JsonBaseParseTypes::String, JsonMember,
-					                           KnownBounds>( parse_state );
-				case '0':
-				case '1':
-				case '2':
-				case '3':
-				case '4':
-				case '5':
-				case '6':
-				case '7':
-				case '8':
-				case '9':
-				case '+':
-				case '-':
-					return parse_variant_value<JsonBaseParseTypes::Number, JsonMember,
-					                           KnownBounds>( parse_state );
+				if( idx == table_t::no_alternative ) {
+					daw_json_error( ErrorReason::UnexpectedJSONVariantType );
 				}
 				if constexpr( ParseState::is_unchecked_input ) {
 					DAW_UNREACHABLE( );
@@ -821,6 +905,58 @@ namespace daw::json {
 				}
 			}
 
+			DAW_JSON_MAKE_REQ_TYPE_ALIAS_TRAIT(
+			  is_seedable_json_member_list_v,
+			  T::i_am_a_seedable_json_member_list );
+
+			/// @brief Can the alternative of a variant be parsed from the members
+			/// seen while searching for the tag
+			template<typename JsonMember, typename = void>
+			inline constexpr bool can_parse_class_seeded_v = false;
+
+			template<typename JsonMember>
+			inline constexpr bool can_parse_class_seeded_v<
+			  JsonMember,
+			  std::enable_if_t<JsonMember::expected_type == JsonParseTypes::Class>> =
+			  is_seedable_json_member_list_v<
+			    json_data_contract_trait_t<typename JsonMember::wrapped_type>> and
+			  not is_pinned_type_v<typename JsonMember::wrapped_type> and
+			  not is_deduced_empty_class_v<JsonMember>;
+
+			/// @brief Search the members of a class for the tag member of a variant
+			/// and stop once it is found.  Each member passed over, including the
+			/// tag, is recorded in seen.
+			/// @param parse_state At the first member of the class.  When the tag is
+			/// found, it is left at the member after it
+			/// @param tag_value The range of the tag's value when found
+			/// @return true if the tag member was found
+			template<typename TagMember, typename ParseState, typename SeenMembers>
+			[[nodiscard]] static constexpr bool
+			find_variant_tag_member( ParseState &parse_state, SeenMembers &seen,
+			                         ParseState &tag_value ) {
+				auto const tag_name = daw::string_view( std::data( TagMember::name ),
+				                                        std::size( TagMember::name ) );
+				while( parse_state.has_more( ) and parse_state.front( ) != '}' ) {
+					auto const name = parse_name( parse_state );
+					auto const value = skip_value( parse_state );
+					seen.push_back( name, value );
+					parse_state.move_next_member_or_end( );
+					if( name == tag_name ) {
+						tag_value = value;
+						return true;
+					}
+				}
+				return false;
+			}
+
+			template<typename TagMember, typename Switcher, typename ParseState>
+			[[nodiscard]] DAW_ATTRIB_INLINE static constexpr auto
+			switch_on_tag( ParseState &tag_value ) {
+				return Switcher{ }(
+				  parse_value<without_name<TagMember>, true, TagMember::expected_type>(
+				    tag_value ) );
+			}
+
 			template<typename JsonMember, typename ParseState>
 			static constexpr auto find_index( ParseState const &parse_state ) {
 				using tag_member = typename JsonMember::tag_member;
@@ -841,6 +977,20 @@ namespace daw::json {
 					// This is a regular class, class must start with '{'
 					daw_json_assert_weak( parse_state2.is_opening_brace_checked( ),
 					                      ErrorReason::InvalidClassStart, parse_state );
+					{
+						// Only scan the class until the tag is found
+						auto search_state = parse_state2;
+						search_state.set_class_position( );
+						search_state.remove_prefix( );
+						search_state.trim_left( );
+						auto seen = discard_seen_class_members_t{ };
+						auto tag_value = ParseState( );
+						if( find_variant_tag_member<tag_member>( search_state, seen,
+						                                         tag_value ) ) {
+							return switch_on_tag<tag_member, switcher_t>( tag_value );
+						}
+					}
+					// The tag is missing, it may be nullable or have a default
 					return switcher_t{ }( std::get<0>(
 					  parse_value<class_wrapper_t, false, class_wrapper_t::expected_type>(
 					    parse_state2 )
@@ -857,15 +1007,90 @@ namespace daw::json {
 				  index, parse_state );
 			}
 
+			/// @brief Parse the alternative idx of a variant from a class whose
+			/// members up to, and including, the tag were already passed over.
+			/// Alternatives that cannot use the seen members are parsed from
+			/// start_state.
+			template<typename Result, typename TypeList, std::size_t pos = 0,
+			         typename ParseState, typename OldClassPos, typename SeenMembers>
+			[[nodiscard]] DAW_ATTRIB_INLINE static constexpr Result
+			parse_visit_seeded( std::size_t idx, ParseState &parse_state,
+			                    ParseState const &start_state,
+			                    OldClassPos const &old_class_pos,
+			                    SeenMembers const &seen ) {
+				if( idx == pos ) {
+					using JsonMember = pack_element_t<pos, TypeList>;
+					if constexpr( can_parse_class_seeded_v<JsonMember> ) {
+						auto result = json_data_contract_trait_t<
+						  typename JsonMember::wrapped_type>::
+						  template parse_to_class_seeded<JsonMember>(
+						    parse_state, old_class_pos, seen );
+						parse_state.trim_left_checked( );
+						if constexpr( std::is_same_v<json_result_t<JsonMember>, Result> ) {
+							return result;
+						} else {
+							return Result{ std::move( result ) };
+						}
+					} else {
+						parse_state = start_state;
+						return parse_visit<Result, TypeList, pos>( idx, parse_state );
+					}
+				}
+				if constexpr( pos + 1 < pack_size_v<TypeList> ) {
+					return parse_visit_seeded<Result, TypeList, pos + 1>(
+					  idx, parse_state, start_state, old_class_pos, seen );
+				} else {
+					if constexpr( ParseState::is_unchecked_input ) {
+						DAW_UNREACHABLE( );
+					} else {
+						daw_json_error( ErrorReason::MissingMemberNameOrEndOfClass,
+						                parse_state );
+					}
+				}
+			}
+
 			template<typename JsonMember, typename ParseState>
 			[[nodiscard]] static constexpr json_result_t<JsonMember>
 			parse_value_variant_intrusive( ParseState &parse_state ) {
+				using tag_submember = typename JsonMember::tag_submember;
+				using switcher_t = typename JsonMember::switcher;
+				using element_map_t = typename JsonMember::json_elements::element_map_t;
+
+				if constexpr( not is_an_ordered_member_v<tag_submember> ) {
+					// Record the members passed over while searching for the tag and
+					// give them to the chosen alternative so the class is only scanned
+					// once
+					parse_state.trim_left( );
+					daw_json_assert_weak( parse_state.is_opening_brace_checked( ),
+					                      ErrorReason::InvalidClassStart, parse_state );
+					auto const start_state = parse_state;
+					auto const old_class_pos = parse_state.get_class_position( );
+					parse_state.set_class_position( );
+					parse_state.remove_prefix( );
+					parse_state.trim_left( );
+
+					auto seen = seen_class_members_t<typename ParseState::CharT>{ };
+					auto tag_value = ParseState( );
+					if( find_variant_tag_member<tag_submember>( parse_state, seen,
+					                                            tag_value ) ) {
+						auto const index =
+						  switch_on_tag<tag_submember, switcher_t>( tag_value );
+						if( not seen.is_full ) {
+							return parse_visit_seeded<json_result_t<JsonMember>,
+							                          element_map_t>(
+							  index, parse_state, start_state, old_class_pos, seen );
+						}
+						parse_state = start_state;
+						return parse_visit<json_result_t<JsonMember>, element_map_t>(
+						  index, parse_state );
+					}
+					// The tag is missing, it may be nullable or have a default
+					parse_state = start_state;
+				}
 				auto const index = [&] {
-					using tag_submember = typename JsonMember::tag_submember;
 					using class_wrapper_t =
 					  typename JsonMember::tag_submember_class_wrapper;
 					auto parse_state2 = parse_state;
-					using switcher_t = typename JsonMember::switcher;
 					if constexpr( is_an_ordered_member_v<tag_submember> ) {
 						return switcher_t{ }( std::get<0>(
 						  parse_value<class_wrapper_t, false,
@@ -878,8 +1103,7 @@ namespace daw::json {
 					}
 				}( );
 
-				return parse_visit<json_result_t<JsonMember>,
-				                   typename JsonMember::json_elements::element_map_t>(
+				return parse_visit<json_result_t<JsonMember>, element_map_t>(
 				  index, parse_state );
 			}
 
@@ -17,6 +17,7 @@
 #include "daw_json_req_helper.h"
 #include <daw/json/concepts/daw_nullable_value.h>
 #include <daw/json/daw_json_data_contract.h>
+#include <daw/json/daw_json_parse_options.h>
 
 #include <daw/cpp_17.h>
 #include <daw/daw_fwd_pack_apply.h>
@@ -176,6 +177,16 @@ namespace daw::json {
 		using can_single_allocation_string =
 		  std::bool_constant<can_single_allocation_string_v<T>>;
 
+		namespace json_details {
+			/// @brief Fixed capacity strings are unescaped directly into their own
+			/// storage.  They provide i_am_a_fixed_capacity_string, a static
+			/// fixed_capacity, a static FixedStringOverflow overflow_policy, a
+			/// writable data( ) and set_size( n ) for n <= fixed_capacity, which
+			/// sets the size to n chars already written through data( )
+			DAW_JSON_MAKE_REQ_TYPE_ALIAS_TRAIT( is_fixed_capacity_string_v,
+			                                    T::i_am_a_fixed_capacity_string );
+		} // namespace json_details
+
 		namespace json_details {
 			DAW_JSON_MAKE_REQ_TYPE_ALIAS_TRAIT( is_a_json_type_v,
 			                                    T::i_am_a_json_type );
@@ -235,6 +246,17 @@ namespace daw::json {
 		using is_zero_terminated_string =
 		  std::bool_constant<is_zero_terminated_string_v<T>>;
 
+		/***
+		 * Trait for passively exploiting json_input_padding readable bytes after
+		 * the end of the string when the type guarantees it.  See
+		 * options::PaddedInput
+		 */
+		template<typename>
+		inline constexpr bool is_padded_input_v = false;
+
+		template<typename T>
+		using is_padded_input = std::bool_constant<is_padded_input_v<T>>;
+
 		namespace json_details {
 			template<typename ParsePolicy, auto Option>
 			using apply_policy_option_t =
@@ -245,6 +267,13 @@ namespace daw::json {
 			  is_zero_terminated_string_v<daw::remove_cvref_t<String>>,
 			  apply_policy_option_t<ParsePolicy, Option>, ParsePolicy>;
 
+			template<typename ParsePolicy, typename String>
+			using apply_padded_policy_option_t =
+			  daw::conditional_t<is_padded_input_v<daw::remove_cvref_t<String>>,
+			                     apply_policy_option_t<ParsePolicy,
+			                                           options::PaddedInput::yes>,
+			                     ParsePolicy>;
+
 			template<typename String>
 			inline constexpr bool is_mutable_string_v =
 			  not std::is_const_v<std::remove_pointer_t<std::remove_reference_t<
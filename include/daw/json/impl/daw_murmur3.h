@@ -69,22 +69,78 @@ namespace daw {
 		return hash;
 	}
 
+	/// @brief Hash of names of at most sizeof( UInt32 ) chars
+	/// @pre std::size( key ) <= sizeof( UInt32 )
+	[[nodiscard]] DAW_ATTRIB_INLINE static constexpr UInt32
+	short_name_hash( daw::string_view key ) {
+		auto const Sz = std::size( key );
+		auto result = 0_u32;
+		auto const *ptr = std::data( key );
+		for( std::size_t n = 0; n < Sz; ++n ) {
+			result <<= 8U;
+			result |= static_cast<unsigned char>( ptr[n] );
+		}
+		return result * 0xCC9E'2d51UL; // mix it up with an fnv1a prime
+	}
+
 	template<bool expect_long_strings>
 	[[nodiscard]] DAW_ATTRIB_INLINE static constexpr UInt32
 	name_hash( daw::string_view key ) {
-		if( auto const Sz = std::size( key );
-		    DAW_LIKELY( Sz <= sizeof( UInt32 ) ) ) {
-			auto result = 0_u32;
-			auto const *ptr = std::data( key );
-			for( std::size_t n = 0; n < Sz; ++n ) {
-				result <<= 8U;
-				result |= static_cast<unsigned char>( ptr[n] );
-			}
-			return result * 0xCC9E'2d51UL; // mix it up with an fnv1a prime
+		if( DAW_LIKELY( std::size( key ) <= sizeof( UInt32 ) ) ) {
+			return short_name_hash( key );
 		}
 		return fnv1a_32<expect_long_strings>( key );
 	}
 
+	namespace crc32c_details {
+		struct crc32c_table_t {
+			std::uint32_t values[256];
+		};
+
+		// Reflected Castagnoli polynomial, as used by the SSE4.2 crc32
+		// instruction
+		[[nodiscard]] static constexpr crc32c_table_t make_crc32c_table( ) {
+			auto result = crc32c_table_t{ };
+			for( std::uint32_t n = 0; n < 256U; ++n ) {
+				std::uint32_t crc = n;
+				for( int bit = 0; bit < 8; ++bit ) {
+					crc = ( crc & 1U ) != 0 ? ( crc >> 1U ) ^ 0x82F6'3B78U : crc >> 1U;
+				}
+				result.values[n] = crc;
+			}
+			return result;
+		}
+
+		inline constexpr crc32c_table_t crc32c_table = make_crc32c_table( );
+	} // namespace crc32c_details
+
+	/// @brief CRC32C of key, computed a byte at a time.  It gives the same
+	/// result as the SSE4.2 crc32 instruction and can be used at compile time
+	template<typename StringView>
+	[[nodiscard]] static constexpr std::uint32_t crc32c( StringView key ) {
+		static_assert( daw::traits::is_string_view_like_v<StringView>,
+		               "Can only pass contiguous character ranges to crc32c" );
+		std::uint32_t crc = 0xFFFF'FFFFU;
+		auto const *ptr = std::data( key );
+		for( std::size_t n = 0; n < std::size( key ); ++n ) {
+			crc = crc32c_details::crc32c_table
+			        .values[( crc ^ static_cast<unsigned char>( ptr[n] ) ) & 0xFFU] ^
+			      ( crc >> 8U );
+		}
+		return ~crc;
+	}
+
+	/// @brief Name hash used with the SSE4.2 exec mode.  Longer names are
+	/// hashed with CRC32C, which the crc32 instruction computes at runtime.
+	/// This is the compile time version, used to build member tables
+	[[nodiscard]] DAW_ATTRIB_INLINE static constexpr UInt32
+	crc32c_name_hash( daw::string_view key ) {
+		if( DAW_LIKELY( std::size( key ) <= sizeof( UInt32 ) ) ) {
+			return short_name_hash( key );
+		}
+		return to_uint32( crc32c( key ) );
+	}
+
 	template<typename StringView>
 	[[nodiscard]] static constexpr UInt32 murmur3_32( StringView key,
 	                                                  std::uint32_t seed = 0 ) {
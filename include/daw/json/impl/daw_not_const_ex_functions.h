@@ -34,6 +34,7 @@
 #endif
 
 #include <cstddef>
+#include <cstdint>
 #include <cstring>
 
 namespace daw::json {
@@ -89,6 +90,19 @@ namespace daw::json {
 #endif
 			}
 
+			inline std::size_t popcount( runtime_exec_tag, std::uint64_t value ) {
+#if DAW_HAS_BUILTIN( __builtin_popcountll )
+				return static_cast<std::size_t>( __builtin_popcountll( value ) );
+#else
+				std::size_t result = 0;
+				while( value != 0 ) {
+					value &= value - 1U;
+					++result;
+				}
+				return result;
+#endif
+			}
+
 #if defined( DAW_ALLOW_SSE42 )
 			DAW_ATTRIB_INLINE __m128i
 			set_reverse( char c0, char c1 = 0, char c2 = 0, char c3 = 0, char c4 = 0,
@@ -109,6 +123,37 @@ namespace daw::json {
 				return _mm_load_si128( reinterpret_cast<__m128i const *>( ptr ) );
 			}
 
+			/// @brief CRC32C of [first, first + size) using the crc32 instruction.
+			/// The result is the same as daw::crc32c
+			DAW_ATTRIB_INLINE std::uint32_t crc32c( sse42_exec_tag, char const *first,
+			                                        std::size_t size ) {
+				std::uint32_t crc = 0xFFFF'FFFFU;
+#if defined( __x86_64__ ) or defined( _M_X64 )
+				std::uint64_t crc64 = crc;
+				while( size >= 8 ) {
+					std::uint64_t value;
+					memcpy( &value, first, 8 );
+					crc64 = _mm_crc32_u64( crc64, value );
+					first += 8;
+					size -= 8;
+				}
+				crc = static_cast<std::uint32_t>( crc64 );
+#endif
+				while( size >= 4 ) {
+					std::uint32_t value;
+					memcpy( &value, first, 4 );
+					crc = _mm_crc32_u32( crc, value );
+					first += 4;
+					size -= 4;
+				}
+				while( size > 0 ) {
+					crc = _mm_crc32_u8( crc, static_cast<unsigned char>( *first ) );
+					++first;
+					--size;
+				}
+				return ~crc;
+			}
+
 			template<char k>
 			DAW_ATTRIB_INLINE UInt32 mem_find_eq( sse42_exec_tag, __m128i block ) {
 				__m128i const keys = _mm_set1_epi8( k );
@@ -150,6 +195,25 @@ namespace daw::json {
 				return last;
 			}
 
+			/// @brief Count the occurrences of k in [first, last)
+			template<char k>
+			DAW_ATTRIB_NONNULL( )
+			inline std::size_t mem_count( sse42_exec_tag tag, char const *first,
+			                              char const *const last ) {
+				std::size_t result = 0;
+				while( last - first >= 16 ) {
+					auto const found =
+					  mem_find_eq<k>( tag, uload16_char_data( tag, first ) );
+					result += popcount( tag, static_cast<std::uint64_t>( found ) );
+					first += 16;
+				}
+				while( first < last ) {
+					result += *first == k ? 1U : 0U;
+					++first;
+				}
+				return result;
+			}
+
 			template<bool is_unchecked_input, char... keys, typename CharT>
 			DAW_ATTRIB_INLINE CharT *
 			mem_move_to_next_not_of( sse42_exec_tag tag, CharT *first, CharT *last ) {
@@ -345,6 +409,67 @@ namespace daw::json {
 				                                                            : last;
 			}
 
+			/***
+			 * The padded kernels below load whole 16 byte blocks up to the end of
+			 * the input.  The block starting before last can extend past it into
+			 * the json_input_padding bytes, so there is no scalar tail.  Matches at
+			 * or past last are ignored.
+			 */
+			template<bool is_unchecked_input, char... keys, typename CharT>
+			DAW_ATTRIB_INLINE CharT *mem_move_to_next_of( sse42_padded_exec_tag tag,
+			                                              CharT *first,
+			                                              CharT *const last ) {
+				while( first < last ) {
+					auto const val0 = uload16_char_data( tag, first );
+					auto const key_positions = ( mem_find_eq<keys>( tag, val0 ) | ... );
+					if( key_positions != 0 ) {
+						first += find_lsb_set( tag, key_positions );
+						return first < last ? first : last;
+					}
+					first += 16;
+				}
+				return last;
+			}
+
+			template<bool is_unchecked_input, typename CharT>
+			DAW_ATTRIB_NONNULL( )
+			DAW_ATTRIB_RET_NONNULL inline CharT *mem_skip_until_end_of_string(
+			  sse42_padded_exec_tag tag, CharT *first, CharT *const last,
+			  std::ptrdiff_t &first_escape ) {
+				CharT *const first_first = first;
+				UInt32 prev_escapes = 0_u32;
+				while( first < last ) {
+					auto const val0 = uload16_char_data( tag, first );
+					UInt32 const backslashes = mem_find_eq<'\\'>( tag, val0 );
+					UInt32 const escaped =
+					  find_escaped_branchless( tag, prev_escapes, backslashes );
+					UInt32 const quotes = mem_find_eq<'"'>( tag, val0 ) & ( ~escaped );
+					std::ptrdiff_t const quote_pos =
+					  quotes != 0 ? find_lsb_set( tag, quotes ) : 16;
+					if( ( backslashes != 0 ) & ( first_escape < 0 ) ) {
+						std::ptrdiff_t const escape_pos = find_lsb_set( tag, backslashes );
+						if( escape_pos < quote_pos ) {
+							first_escape = ( first - first_first ) + escape_pos;
+						}
+					}
+					if( quotes != 0 ) {
+						first += quote_pos;
+						return first < last ? first : last;
+					}
+					first += 16;
+				}
+				return last;
+			}
+
+			template<bool is_unchecked_input, typename CharT>
+			DAW_ATTRIB_NONNULL( )
+			DAW_ATTRIB_RET_NONNULL inline CharT *
+			mem_skip_until_end_of_string( sse42_padded_exec_tag tag, CharT *first,
+			                              CharT *const last ) {
+				std::ptrdiff_t first_escape = 0;
+				return mem_skip_until_end_of_string<is_unchecked_input>(
+				  tag, first, last, first_escape );
+			}
 #endif
 			template<bool is_unchecked_input, char... keys, typename CharT>
 			DAW_ATTRIB_NONNULL( )
@@ -374,6 +499,44 @@ namespace daw::json {
 				}
 			}
 
+			/// @brief Count the occurrences of k in [first, last), 8 bytes at a time
+			template<char k>
+			DAW_ATTRIB_NONNULL( )
+			inline std::size_t mem_count( runtime_exec_tag tag, char const *first,
+			                              char const *const last ) {
+				constexpr std::uint64_t ones = 0x0101'0101'0101'0101ULL;
+				constexpr std::uint64_t low7 = 0x7F7F'7F7F'7F7F'7F7FULL;
+				constexpr std::uint64_t keys = ones * static_cast<unsigned char>( k );
+				std::size_t result = 0;
+				while( last - first >= 8 ) {
+					std::uint64_t word = 0;
+					memcpy( &word, first, 8 );
+					// The high bit of each byte is set where the byte is zero
+					auto const found = word ^ keys;
+					auto const zeros = ~( ( ( found & low7 ) + low7 ) | found | low7 );
+					result += popcount( tag, zeros );
+					first += 8;
+				}
+				while( first < last ) {
+					result += *first == k ? 1U : 0U;
+					++first;
+				}
+				return result;
+			}
+
+			/// @brief Count the occurrences of k in [first, last)
+			template<char k>
+			DAW_ATTRIB_NONNULL( )
+			constexpr std::size_t mem_count( constexpr_exec_tag, char const *first,
+			                                 char const *const last ) {
+				std::size_t result = 0;
+				while( first < last ) {
+					result += *first == k ? 1U : 0U;
+					++first;
+				}
+				return result;
+			}
+
 			template<bool is_unchecked_input, typename CharT>
 			DAW_ATTRIB_NONNULL( )
 			DAW_ATTRIB_RET_NONNULL DAW_ATTRIB_INLINE CharT *mem_skip_string(
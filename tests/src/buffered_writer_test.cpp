@@ -0,0 +1,153 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#include "defines.h"
+
+#include <daw/json/concepts/daw_writable_output_buffered.h>
+#include <daw/json/daw_json_link.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+struct Event {
+	std::int64_t id;
+	std::string name;
+	std::vector<double> values;
+};
+
+namespace daw::json {
+	template<>
+	struct json_data_contract<Event> {
+		static constexpr char const id[] = "id";
+		static constexpr char const name[] = "name";
+		static constexpr char const values[] = "values";
+		using type = json_member_list<json_link<id, std::int64_t>,
+		                              json_link<name, std::string>,
+		                              json_link<values, std::vector<double>>>;
+
+		static constexpr auto to_json_data( Event const &e ) {
+			return std::forward_as_tuple( e.id, e.name, e.values );
+		}
+	};
+} // namespace daw::json
+
+/// Records each chunk passed to it
+struct recording_sink {
+	std::string *output;
+	std::vector<std::size_t> *chunk_sizes;
+
+	void operator( )( char const *first, std::size_t size ) const {
+		output->append( first, size );
+		chunk_sizes->push_back( size );
+	}
+
+	void flush( ) const {}
+};
+
+std::string read_all( std::FILE *f ) {
+	std::rewind( f );
+	auto result = std::string( );
+	char buff[256];
+	std::size_t count = 0;
+	while( ( count = std::fread( buff, 1, sizeof( buff ), f ) ) > 0 ) {
+		result.append( buff, count );
+	}
+	return result;
+}
+
+int main( )
+#if defined( DAW_USE_EXCEPTIONS )
+  try
+#endif
+{
+	auto events = std::vector<Event>{ };
+	for( std::int64_t n = 0; n < 100; ++n ) {
+		events.push_back( Event{ n, "event " + std::to_string( n ),
+		                         { 1.5 * static_cast<double>( n ), 2.0 } } );
+	}
+	auto expected = std::string( );
+	for( auto const &e : events ) {
+		expected += daw::json::to_json( e );
+		expected += '\n';
+	}
+
+	{
+		auto output = std::string( );
+		auto chunk_sizes = std::vector<std::size_t>( );
+		auto writer = daw::json::basic_buffered_writer<recording_sink>(
+		  recording_sink{ &output, &chunk_sizes }, 64 );
+		for( auto const &e : events ) {
+			(void)daw::json::to_json( e, writer );
+			daw::json::put_output( writer, '\n' );
+		}
+		writer.flush( );
+		ensure( writer.buffered_size( ) == 0 );
+		ensure( output == expected );
+		for( auto sz : chunk_sizes ) {
+			ensure( sz <= 64 );
+		}
+		ensure( chunk_sizes.size( ) < expected.size( ) / 32 );
+
+		// Output larger than the buffer is passed through as one chunk
+		chunk_sizes.clear( );
+		auto const large = std::string( 200, 'x' );
+		daw::json::write_output( writer, large );
+		ensure( chunk_sizes.size( ) == 1 and chunk_sizes[0] == 200 );
+	}
+
+	{
+		std::FILE *f = std::tmpfile( );
+		ensure( f != nullptr );
+		{
+			auto writer =
+			  daw::json::buffered_file_writer( daw::json::json_file_sink{ f }, 128 );
+			for( auto const &e : events ) {
+				(void)daw::json::to_json( e, writer );
+				daw::json::put_output( writer, '\n' );
+			}
+		}
+		ensure( read_all( f ) == expected );
+		std::fclose( f );
+	}
+
+#if not defined( DAW_HAS_MSVC_LIKE )
+	{
+		std::FILE *f = std::tmpfile( );
+		ensure( f != nullptr );
+		{
+			auto writer =
+			  daw::json::buffered_fd_writer( daw::json::json_fd_sink{ fileno( f ) } );
+			for( auto const &e : events ) {
+				(void)daw::json::to_json( e, writer );
+				daw::json::put_output( writer, '\n' );
+			}
+			writer.flush( );
+		}
+		ensure( read_all( f ) == expected );
+		std::fclose( f );
+	}
+#endif
+}
+#if defined( DAW_USE_EXCEPTIONS )
+catch( daw::json::json_exception const &jex ) {
+	std::cerr << "Exception thrown by parser: " << jex.reason( ) << '\n';
+	exit( 1 );
+} catch( std::exception const &ex ) {
+	std::cerr << "Unknown exception thrown during testing: " << ex.what( )
+	          << '\n';
+	exit( 1 );
+} catch( ... ) {
+	std::cerr << "Unknown exception thrown during testing\n";
+	throw;
+}
+#endif
@@ -9,9 +9,23 @@
 #include "defines.h"
 
 #include "daw/json/impl/daw_murmur3.h"
+#include "daw/json/impl/daw_not_const_ex_functions.h"
 
 #include <daw/daw_benchmark.h>
 
+#include <string>
+
+static void test_crc32c( daw::string_view key, std::uint32_t expected ) {
+	daw::expecting( daw::crc32c( key ) == expected );
+#if defined( DAW_ALLOW_SSE42 )
+	// The crc32 instruction must agree with the compile time version, as
+	// member name tables are built with it
+	daw::expecting( daw::json::json_details::crc32c(
+	                  daw::json::sse42_exec_tag{ }, std::data( key ),
+	                  std::size( key ) ) == expected );
+#endif
+}
+
 static void test( daw::string_view key, std::uint32_t seed,
                   std::uint32_t expected ) {
 	daw::UInt32 answer = daw::murmur3_32( key, seed );
@@ -57,4 +71,22 @@ int main( int, char ** ) {
 	test( "abc", 0, 0xB3DD93FA );
 	test( "abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq", 0,
 	      0xEE925B90 );
+
+	static_assert( daw::crc32c( daw::string_view( "123456789" ) ) ==
+	               0xE306'9283U );
+	test_crc32c( "", 0 );
+	test_crc32c( "123456789", 0xE306'9283U );
+	test_crc32c( std::string( 32, '\0' ), 0x8A91'36AAU );
+	test_crc32c( std::string( 32, '\xFF' ), 0x62A8'AB43U );
+#if defined( DAW_ALLOW_SSE42 )
+	// Every length, so that each of the 8, 4, and 1 byte steps are used
+	for( std::size_t n = 0; n < aas.size( ); ++n ) {
+		daw::expecting( daw::json::json_details::crc32c(
+		                  daw::json::sse42_exec_tag{ }, aas.data( ), n ) ==
+		                daw::crc32c( daw::string_view( aas.data( ), n ) ) );
+	}
+#endif
+	// Names of up to 4 chars use the same hash either way
+	daw::expecting( daw::crc32c_name_hash( "abcd" ) ==
+	                daw::name_hash<false>( "abcd" ) );
 }
@@ -0,0 +1,108 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#include "defines.h"
+
+#include <daw/json/daw_json_find_paths.h>
+#include <daw/json/daw_json_link.h>
+
+#include <cstdlib>
+#include <iostream>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+static constexpr std::string_view json_doc = R"json(
+{
+	"id": 1234,
+	"header": {
+		"route": "orders",
+		"tags": [ "a", "b", "c" ],
+		"priority": 5
+	},
+	"body": [
+		{ "sku": "x1", "qty": 2 },
+		{ "sku": "x2", "qty": 7 }
+	],
+	"trailer": { "crc": 99 }
+}
+)json";
+
+void test_fixed_paths( ) {
+	auto const values = daw::json::find_json_paths(
+	  json_doc, { "header.route", "body[1].qty", "id", "header.tags[2]",
+	              "missing", "header.priority.nope", "" } );
+	test_assert( values.size( ) == 7, "Expected a value per path" );
+	test_assert( values[0].as<std::string_view>( ) == "orders",
+	             "Unexpected header.route" );
+	test_assert( values[1].as<int>( ) == 7, "Unexpected body[1].qty" );
+	test_assert( values[2].as<int>( ) == 1234, "Unexpected id" );
+	test_assert( values[3].as<std::string_view>( ) == "c",
+	             "Unexpected header.tags[2]" );
+	test_assert( not values[4], "Path should not be found" );
+	test_assert( not values[5], "Path through a literal should not be found" );
+	test_assert( values[6].is_class( ), "Empty path should be the root" );
+	test_assert( values[1].get_string_view( ) == "7",
+	             "Unexpected raw range for body[1].qty" );
+}
+
+void test_prefix_paths( ) {
+	auto const values = daw::json::find_json_paths(
+	  json_doc, { "body[0]", "body[0].sku", "body", "trailer.crc" } );
+	test_assert( values[0].is_class( ), "Expected body[0] to be a class" );
+	test_assert( values[1].as<std::string_view>( ) == "x1",
+	             "Unexpected body[0].sku" );
+	test_assert( values[2].is_array( ), "Expected body to be an array" );
+	test_assert( values[3].as<int>( ) == 99, "Unexpected trailer.crc" );
+}
+
+void test_runtime_paths( ) {
+	auto const paths =
+	  std::vector<std::string_view>{ "trailer.crc", "header.priority", "id" };
+	auto const values = daw::json::find_json_paths( json_doc, paths );
+	test_assert( values.size( ) == 3, "Expected a value per path" );
+	test_assert( values[0].as<int>( ) == 99, "Unexpected trailer.crc" );
+	test_assert( values[1].as<int>( ) == 5, "Unexpected header.priority" );
+	test_assert( values[2].as<int>( ) == 1234, "Unexpected id" );
+}
+
+void test_from_json_paths( ) {
+	auto const [route, qty, crc, missing] =
+	  daw::json::from_json_paths<std::string, int, int, std::optional<int>>(
+	    json_doc, { "header.route", "body[0].qty", "trailer.crc", "nope" } );
+	test_assert( route == "orders", "Unexpected route" );
+	test_assert( qty == 2, "Unexpected qty" );
+	test_assert( crc == 99, "Unexpected crc" );
+	test_assert( not missing, "Expected missing to be empty" );
+}
+
+int main( )
+#if defined( DAW_USE_EXCEPTIONS )
+  try
+#endif
+{
+	test_fixed_paths( );
+	test_prefix_paths( );
+	test_runtime_paths( );
+	test_from_json_paths( );
+	std::cout << "done\n";
+}
+#if defined( DAW_USE_EXCEPTIONS )
+catch( daw::json::json_exception const &jex ) {
+	std::cerr << "Exception thrown by parser: " << jex.reason( ) << '\n';
+	exit( 1 );
+} catch( std::exception const &ex ) {
+	std::cerr << "Unknown exception thrown during testing: " << ex.what( )
+	          << '\n';
+	exit( 1 );
+} catch( ... ) {
+	std::cerr << "Unknown exception thrown during testing\n";
+	throw;
+}
+#endif
@@ -0,0 +1,115 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#include "defines.h"
+
+#include <daw/json/daw_json_aggregate.h>
+#include <daw/json/daw_json_link.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+
+int main( )
+#if defined( DAW_USE_EXCEPTIONS )
+  try
+#endif
+{
+	constexpr daw::string_view json_doc = R"json(
+{
+	"meta": { "count": 5 },
+	"orders": [
+		{ "id": "a", "items": [ { "name": "x" } ], "price": 10.5, "qty": 2 },
+		{ "id": "b", "price": 4, "qty": 1, "note": { "price": 1000 } },
+		{ "id": "c", "qty": 7 },
+		{ "id": "d", "price": null, "qty": 3, "ship": { "cost": 5 } },
+		{ "id": "e", "price": 25.25, "qty": 9, "ship": { "cost": 7 } }
+	]
+})json";
+
+	auto price =
+	  daw::json::aggregate_json_array<double>( json_doc, "price", "orders" );
+	ensure( price.count( ) == 3 );
+	ensure( price.sum( ) == 39.75 );
+	ensure( price.min( ) == 4.0 and price.max( ) == 25.25 );
+	ensure( price.mean( ) == 13.25 );
+
+	auto qty =
+	  daw::json::aggregate_json_array<std::int64_t>( json_doc, "qty", "orders" );
+	ensure( qty.count( ) == 5 and qty.sum( ) == 22 );
+	ensure( qty.min( ) == 1 and qty.max( ) == 9 );
+
+	auto ship = daw::json::aggregate_json_array<int>( json_doc, "ship.cost",
+	                                                   "orders" );
+	ensure( ship.count( ) == 2 and ship.sum( ) == 12 );
+
+	auto hist = daw::json::for_each_json_array_value<int>(
+	  json_doc, "qty", daw::json::json_histogram<int>( 0, 8, 4 ), "orders" );
+	ensure( hist.bins( ).size( ) == 4 );
+	ensure( hist.bins( )[0] == 1 ); // 1
+	ensure( hist.bins( )[1] == 2 ); // 2, 3
+	ensure( hist.bins( )[2] == 0 );
+	ensure( hist.bins( )[3] == 1 ); // 7
+	ensure( hist.overflow( ) == 1 and hist.underflow( ) == 0 );
+	ensure( hist.count( ) == 5 );
+	ensure( hist.bin_first( 2 ) == 4.0 );
+
+	// Arrays of numbers
+	auto numbers = daw::json::aggregate_json_array<int>( "[3, -1, 4, 1, 5]", "" );
+	ensure( numbers.count( ) == 5 and numbers.sum( ) == 12 );
+	ensure( numbers.min( ) == -1 and numbers.max( ) == 5 );
+
+	constexpr daw::string_view json_lines_doc =
+	  R"jsonl({"ts":1,"latency":{"ms":12}}
+{"ts":2,"latency":{"ms":30},"tags":["slow"]}
+{"ts":3}
+{"ts":4,"latency":{"ms":3}}
+)jsonl";
+	auto latency =
+	  daw::json::aggregate_json_lines<unsigned>( json_lines_doc, "latency.ms" );
+	ensure( latency.count( ) == 3 and latency.sum( ) == 45U );
+	ensure( latency.min( ) == 3U and latency.max( ) == 30U );
+
+	// Array indices in the path, and the rest of each record is skipped after
+	// the value is found
+	auto second = daw::json::aggregate_json_lines<int>(
+	  R"jsonl({"v":[10,20,{"a":"]}"}],"w":1}
+{"w":2,"v":[5]}
+{"v":[[1],7],"v":[0,1000]}
+)jsonl",
+	  "v[1]" );
+	ensure( second.count( ) == 2 and second.sum( ) == 27 );
+	auto nested = daw::json::aggregate_json_lines<int>(
+	  R"jsonl({"v":[10,[3,4]]}
+{"v":[1,{"x":4}]}
+)jsonl",
+	  "v[1][1]" );
+	ensure( nested.count( ) == 1 and nested.sum( ) == 4 );
+
+	std::size_t calls = 0;
+	(void)daw::json::for_each_json_lines_value<int>(
+	  json_lines_doc, "ts", [&]( int ts ) {
+		  ensure( ts == static_cast<int>( calls + 1 ) );
+		  ++calls;
+	  } );
+	ensure( calls == 4 );
+}
+#if defined( DAW_USE_EXCEPTIONS )
+catch( daw::json::json_exception const &jex ) {
+	std::cerr << "Exception thrown by parser: " << jex.reason( ) << '\n';
+	exit( 1 );
+} catch( std::exception const &ex ) {
+	std::cerr << "Unknown exception thrown during testing: " << ex.what( )
+	          << '\n';
+	exit( 1 );
+} catch( ... ) {
+	std::cerr << "Unknown exception thrown during testing\n";
+	throw;
+}
+#endif
@@ -0,0 +1,115 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#include "defines.h"
+
+#include <daw/json/daw_json_array_index.h>
+#include <daw/json/daw_json_link.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <tuple>
+
+struct Page {
+	int id;
+	std::string title;
+};
+
+namespace daw::json {
+	template<>
+	struct json_data_contract<Page> {
+		static constexpr char const id[] = "id";
+		static constexpr char const title[] = "title";
+		using type =
+		  json_member_list<json_link<id, int>, json_link<title, std::string>>;
+
+		static constexpr auto to_json_data( Page const &p ) {
+			return std::forward_as_tuple( p.id, p.title );
+		}
+	};
+} // namespace daw::json
+
+int main( )
+#if defined( DAW_USE_EXCEPTIONS )
+  try
+#endif
+{
+	constexpr daw::string_view json_doc = R"json({
+	"total": 6,
+	"pages": [
+		{ "id": 2, "title": "b" },
+		{ "title": "d,]", "id": 4 },
+		{ "id": 6, "title": "f", "extra": [ 1, { "x": [] } ] } ,
+		{ "id": 8, "title": "h" },
+		{"id":10,"title":"j"},
+		{ "id": 12, "title": "l" }
+	]
+})json";
+
+	auto const index = daw::json::json_array_index<Page>( json_doc, "pages" );
+	ensure( index.size( ) == 6 );
+	ensure( not index.empty( ) );
+	ensure( index[0].id == 2 );
+	ensure( index[5].id == 12 and index[5].title == "l" );
+	ensure( index[1].title == "d,]" );
+	ensure( index.raw_element( 1 ) == R"({ "title": "d,]", "id": 4 })" );
+	ensure( index.raw_element( 2 ) ==
+	        R"({ "id": 6, "title": "f", "extra": [ 1, { "x": [] } ] })" );
+	ensure( index.raw_element( 4 ) == R"({"id":10,"title":"j"})" );
+	ensure( index.element_value( 3 )["title"].get_string_view( ) == "h" );
+
+	// Random access iteration and paging
+	ensure( index.end( ) - index.begin( ) == 6 );
+	ensure( ( index.begin( ) + 3 )->id == 8 );
+	ensure( index.begin( )[4].id == 10 );
+	auto page = index.slice( 2, 2 );
+	ensure( page.size( ) == 2 );
+	ensure( page[0].id == 6 and page[1].id == 8 );
+	int expected = 6;
+	for( Page const &p : page ) {
+		ensure( p.id == expected );
+		expected += 2;
+	}
+	ensure( index.slice( 4, 10 ).size( ) == 2 );
+	ensure( index.slice( 6, 1 ).empty( ) );
+
+	// Bisection on a sorted key only parses the key
+	ensure( index.lower_bound( "id", 7 ) == 3 );
+	ensure( index.lower_bound( "id", 8 ) == 3 );
+	ensure( index.lower_bound( "id", 1 ) == 0 );
+	ensure( index.lower_bound( "id", 13 ) == 6 );
+	auto const pos = std::lower_bound(
+	  index.begin( ), index.end( ), 9,
+	  []( Page const &p, int id ) { return p.id < id; } );
+	ensure( pos.position( ) == 4 );
+
+	auto const numbers = daw::json::json_array_index<int>( "[ 5, 3,1 ]" );
+	ensure( numbers.size( ) == 3 );
+	ensure( numbers[2] == 1 );
+	ensure( numbers.raw_element( 0 ) == "5" );
+
+	auto const empty = daw::json::json_array_index<int>( " [ ] " );
+	ensure( empty.empty( ) );
+	ensure( empty.begin( ) == empty.end( ) );
+}
+#if defined( DAW_USE_EXCEPTIONS )
+catch( daw::json::json_exception const &jex ) {
+	std::cerr << "Exception thrown by parser: " << jex.reason( ) << '\n';
+	exit( 1 );
+} catch( std::exception const &ex ) {
+	std::cerr << "Unknown exception thrown during testing: " << ex.what( )
+	          << '\n';
+	exit( 1 );
+} catch( ... ) {
+	std::cerr << "Unknown exception thrown during testing\n";
+	throw;
+}
+#endif
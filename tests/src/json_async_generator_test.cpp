@@ -0,0 +1,234 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#include "defines.h"
+
+#include <daw/json/daw_json_async_generator.h>
+#include <daw/json/daw_json_link.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdlib>
+#include <functional>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#if defined( DAW_JSON_HAS_COROUTINES )
+#include <coroutine>
+#include <deque>
+#include <exception>
+
+struct point {
+	int x;
+	int y;
+	std::string name;
+};
+
+namespace daw::json {
+	template<>
+	struct json_data_contract<point> {
+		static constexpr char const x[] = "x";
+		static constexpr char const y[] = "y";
+		static constexpr char const name[] = "name";
+		using type = json_member_list<json_link<x, int>, json_link<y, int>,
+		                              json_link<name, std::string>>;
+	};
+} // namespace daw::json
+
+/// A coroutine that runs eagerly until it first suspends
+struct test_task {
+	struct promise_type {
+		test_task get_return_object( ) {
+			return test_task{
+			  std::coroutine_handle<promise_type>::from_promise( *this ) };
+		}
+		std::suspend_never initial_suspend( ) noexcept {
+			return { };
+		}
+		std::suspend_always final_suspend( ) noexcept {
+			return { };
+		}
+		void return_void( ) {}
+		void unhandled_exception( ) {
+			std::terminate( );
+		}
+	};
+
+	std::coroutine_handle<promise_type> handle;
+
+	explicit test_task( std::coroutine_handle<promise_type> h )
+	  : handle( h ) {}
+	test_task( test_task const & ) = delete;
+	test_task &operator=( test_task const & ) = delete;
+	~test_task( ) {
+		handle.destroy( );
+	}
+
+	[[nodiscard]] bool done( ) const {
+		return handle.done( );
+	}
+};
+
+/// Reads the next chunk_size bytes of the document.  When is_async, every read
+/// suspends and is completed later from the event loop
+struct chunked_source {
+	std::string_view data;
+	std::size_t chunk_size;
+	bool is_async;
+	std::deque<std::coroutine_handle<>> *pending;
+
+	struct read_awaiter {
+		chunked_source *source;
+		char *buffer;
+		std::size_t capacity;
+
+		bool await_ready( ) const noexcept {
+			return not source->is_async;
+		}
+
+		void await_suspend( std::coroutine_handle<> h ) const {
+			source->pending->push_back( h );
+		}
+
+		std::size_t await_resume( ) const {
+			auto const count = ( std::min )(
+			  { capacity, source->chunk_size, source->data.size( ) } );
+			std::copy_n( source->data.data( ), count, buffer );
+			source->data.remove_prefix( count );
+			return count;
+		}
+	};
+
+	read_awaiter operator( )( char *buffer, std::size_t capacity ) {
+		return read_awaiter{ this, buffer, capacity };
+	}
+};
+
+static constexpr std::string_view array_doc = R"json(
+[
+	{ "x": 1, "y": 2, "name": "a,b]" },
+	{ "x": 3, "y": 4, "name": "c\"d" },
+	{ "x": 5, "y": 6, "name": "[e]" }
+]
+)json";
+
+static constexpr std::string_view lines_doc =
+  "{ \"x\": 1, \"y\": 2, \"name\": \"a\" }\n"
+  "{ \"x\": 3, \"y\": 4, \"name\": \"b\" }\n"
+  "{ \"x\": 5, \"y\": 6, \"name\": \"c\" }";
+
+template<typename Generator>
+test_task collect( Generator gen, std::vector<point> &out ) {
+	while( auto p = co_await gen.next( ) ) {
+		out.push_back( std::move( *p ) );
+	}
+}
+
+test_task sum_ints( daw::json::json_async_generator<int> gen, int &out ) {
+	while( auto v = co_await gen.next( ) ) {
+		out += *v;
+	}
+}
+
+void check_points( std::vector<point> const &points ) {
+	test_assert( points.size( ) == 3, "Expected 3 points" );
+	test_assert( points[0].x == 1 and points[2].y == 6, "Unexpected values" );
+}
+
+void test_array_chunks( ) {
+	// Small chunks with a small buffer split elements and force the buffer to
+	// grow
+	for( std::size_t chunk_size = 1; chunk_size < 20; ++chunk_size ) {
+		auto source = chunked_source{ array_doc, chunk_size, false, nullptr };
+		auto points = std::vector<point>( );
+		auto task = collect(
+		  daw::json::json_array_async_range<point>( std::ref( source ), 16 ),
+		  points );
+		test_assert( task.done( ), "Expected synchronous completion" );
+		check_points( points );
+		test_assert( points[0].name == "a,b]", "Unexpected name" );
+		test_assert( points[1].name == "c\"d", "Unexpected escaped name" );
+		test_assert( points[2].name == "[e]", "Unexpected name" );
+	}
+}
+
+void test_array_async( ) {
+	auto pending = std::deque<std::coroutine_handle<>>( );
+	auto source = chunked_source{ array_doc, 7, true, &pending };
+	auto points = std::vector<point>( );
+	auto task = collect(
+	  daw::json::json_array_async_range<point>( std::ref( source ), 16 ),
+	  points );
+	std::size_t resumes = 0;
+	while( not pending.empty( ) ) {
+		test_assert( not task.done( ), "Expected the task to be suspended" );
+		auto h = pending.front( );
+		pending.pop_front( );
+		h.resume( );
+		++resumes;
+	}
+	test_assert( task.done( ), "Expected the task to complete" );
+	test_assert( resumes > 1, "Expected the reads to suspend" );
+	check_points( points );
+}
+
+void test_lines( ) {
+	for( std::size_t chunk_size = 1; chunk_size < 20; ++chunk_size ) {
+		auto source = chunked_source{ lines_doc, chunk_size, false, nullptr };
+		auto points = std::vector<point>( );
+		auto task = collect(
+		  daw::json::json_lines_async_range<point>( std::ref( source ), 16 ),
+		  points );
+		test_assert( task.done( ), "Expected synchronous completion" );
+		check_points( points );
+		test_assert( points[2].name == "c", "Unexpected last line" );
+	}
+}
+
+void test_empty_and_scalars( ) {
+	auto source = chunked_source{ " [ ] ", 2, false, nullptr };
+	int sum = 0;
+	auto task =
+	  sum_ints( daw::json::json_array_async_range<int>( std::ref( source ) ), sum );
+	test_assert( task.done( ) and sum == 0, "Expected an empty array" );
+
+	auto source2 = chunked_source{ "[1,22,333]", 3, false, nullptr };
+	auto task2 = sum_ints(
+	  daw::json::json_array_async_range<int>( std::ref( source2 ) ), sum );
+	test_assert( task2.done( ) and sum == 356, "Unexpected sum" );
+}
+#endif
+
+int main( )
+#if defined( DAW_USE_EXCEPTIONS )
+  try
+#endif
+{
+#if defined( DAW_JSON_HAS_COROUTINES )
+	test_array_chunks( );
+	test_array_async( );
+	test_lines( );
+	test_empty_and_scalars( );
+#endif
+	std::cout << "done\n";
+}
+#if defined( DAW_USE_EXCEPTIONS )
+catch( daw::json::json_exception const &jex ) {
+	std::cerr << "Exception thrown by parser: " << jex.reason( ) << '\n';
+	exit( 1 );
+} catch( std::exception const &ex ) {
+	std::cerr << "Unknown exception thrown during testing: " << ex.what( )
+	          << '\n';
+	exit( 1 );
+} catch( ... ) {
+	std::cerr << "Unknown exception thrown during testing\n";
+	throw;
+}
+#endif
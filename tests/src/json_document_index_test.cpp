@@ -0,0 +1,89 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#include "defines.h"
+
+#include <daw/json/daw_json_document_index.h>
+#include <daw/json/daw_json_link.h>
+
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <string_view>
+
+static constexpr std::string_view json_doc = R"json(
+{
+	"name": "rules",
+	"limits": { "max": 100, "min": -5, "ratio": 0.5 },
+	"values": [ 1, [ 2, 3 ], { "a": true }, null, "four" ],
+	"empty_class": { },
+	"empty_array": [ ],
+	"dup": 1,
+	"dup": 2,
+	"a.b": 42
+}
+)json";
+
+int main( )
+#if defined( DAW_USE_EXCEPTIONS )
+  try
+#endif
+{
+	auto const idx = daw::json::json_document_index( json_doc );
+	auto const root = idx.root( );
+	test_assert( root.is_class( ), "Expected root to be a class" );
+	test_assert( root.size( ) == 8, "Unexpected member count" );
+	test_assert( root.find_element( 1 ).name( ) == "limits",
+	             "Unexpected member name" );
+
+	test_assert( idx["name"].as<std::string>( ) == "rules", "Unexpected name" );
+	test_assert( idx["limits.max"].as<int>( ) == 100, "Unexpected limits.max" );
+	test_assert( idx["limits.min"].as<int>( ) == -5, "Unexpected limits.min" );
+	test_assert( idx["limits.ratio"].as<double>( ) == 0.5,
+	             "Unexpected limits.ratio" );
+	test_assert( not idx["limits.nope"], "Expected missing member" );
+
+	auto const values = idx["values"];
+	test_assert( values.is_array( ), "Expected an array" );
+	test_assert( values.size( ) == 5, "Unexpected element count" );
+	test_assert( values[1][1].as<int>( ) == 3, "Unexpected values[1][1]" );
+	test_assert( idx["values[2].a"].as<bool>( ), "Unexpected values[2].a" );
+	test_assert( values[3].is_null( ), "Expected null" );
+	test_assert( values[4].get_raw_json( ) == R"("four")",
+	             "Unexpected raw string" );
+	test_assert( not values[5], "Expected out of range element" );
+	// Stepping over a subtree lands on the next sibling
+	test_assert( values[1].next_tape_position( ) ==
+	               values[2].tape_position( ),
+	             "Unexpected subtree skip" );
+
+	test_assert( idx["empty_class"].is_class( ) and
+	               idx["empty_class"].size( ) == 0,
+	             "Expected empty class" );
+	test_assert( idx["empty_array"].is_array( ) and
+	               idx["empty_array"].size( ) == 0,
+	             "Expected empty array" );
+	test_assert( idx["dup"].as<int>( ) == 1,
+	             "Expected the first of duplicate members" );
+	test_assert( idx[R"(a\.b)"].as<int>( ) == 42,
+	             "Expected member with a dot in its name" );
+	std::cout << "done\n";
+}
+#if defined( DAW_USE_EXCEPTIONS )
+catch( daw::json::json_exception const &jex ) {
+	std::cerr << "Exception thrown by parser: " << jex.reason( ) << '\n';
+	exit( 1 );
+} catch( std::exception const &ex ) {
+	std::cerr << "Unknown exception thrown during testing: " << ex.what( )
+	          << '\n';
+	exit( 1 );
+} catch( ... ) {
+	std::cerr << "Unknown exception thrown during testing\n";
+	throw;
+}
+#endif
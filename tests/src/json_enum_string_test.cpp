@@ -0,0 +1,132 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#include "defines.h"
+
+#include <daw/json/daw_json_enum_string.h>
+#include <daw/json/daw_json_link.h>
+
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <vector>
+
+namespace daw::enum_string_test {
+	enum class Status : std::uint8_t { active, suspended, closed };
+	// Values do not need to be contiguous
+	enum class Kind : int { unknown = -1, order = 100, refund = 2000 };
+
+	struct Record {
+		Status status;
+		Kind kind;
+		std::vector<Status> history;
+	};
+
+	bool operator==( Record const &lhs, Record const &rhs ) {
+		return std::tie( lhs.status, lhs.kind, lhs.history ) ==
+		       std::tie( rhs.status, rhs.kind, rhs.history );
+	}
+} // namespace daw::enum_string_test
+
+namespace daw::json {
+	template<>
+	struct json_enum_names<daw::enum_string_test::Status> {
+		using Status = daw::enum_string_test::Status;
+		static constexpr json_enum_name<Status> values[] = {
+		  { Status::active, "active" },
+		  { Status::suspended, "suspended" },
+		  { Status::closed, "closed" } };
+	};
+
+	template<>
+	struct json_enum_names<daw::enum_string_test::Kind> {
+		using Kind = daw::enum_string_test::Kind;
+		static constexpr json_enum_name<Kind> values[] = {
+		  { Kind::unknown, "unknown" },
+		  { Kind::order, "order" },
+		  { Kind::refund, "refund" } };
+	};
+
+	template<>
+	struct json_data_contract<daw::enum_string_test::Record> {
+		static constexpr char const status[] = "status";
+		static constexpr char const kind[] = "kind";
+		static constexpr char const history[] = "history";
+		using type = json_member_list<
+		  json_enum_string<status, daw::enum_string_test::Status>,
+		  json_enum_string<kind, daw::enum_string_test::Kind>,
+		  json_array<history,
+		             json_enum_string_no_name<daw::enum_string_test::Status>>>;
+
+		static constexpr auto
+		to_json_data( daw::enum_string_test::Record const &value ) {
+			return std::forward_as_tuple( value.status, value.kind, value.history );
+		}
+	};
+} // namespace daw::json
+
+using daw::enum_string_test::Kind;
+using daw::enum_string_test::Status;
+
+static_assert( daw::json::enum_string_converter<Status>{ }( "closed" ) ==
+               Status::closed );
+static_assert( daw::json::enum_string_converter<Kind>{ }( Kind::refund ) ==
+               "refund" );
+
+int main( )
+#if defined( DAW_USE_EXCEPTIONS )
+  try
+#endif
+{
+	static constexpr std::string_view json_doc =
+	  R"json({"history":["active","suspended"],"kind":"order","status":"closed"})json";
+
+	auto const rec =
+	  daw::json::from_json<daw::enum_string_test::Record>( json_doc );
+	test_assert( rec.status == Status::closed, "Unexpected status" );
+	test_assert( rec.kind == Kind::order, "Unexpected kind" );
+	test_assert( rec.history.size( ) == 2 and
+	               rec.history[1] == Status::suspended,
+	             "Unexpected history" );
+
+	auto const str = daw::json::to_json( rec );
+	test_assert(
+	  str ==
+	    R"json({"status":"closed","kind":"order","history":["active","suspended"]})json",
+	  "Unexpected serialization" );
+	auto const rec2 = daw::json::from_json<daw::enum_string_test::Record>( str );
+	test_assert( rec == rec2, "Unexpected round trip error" );
+
+#if defined( DAW_USE_EXCEPTIONS )
+	bool has_error = false;
+	try {
+		(void)daw::json::from_json<daw::enum_string_test::Record>(
+		  R"json({"status":"open","kind":"order","history":[]})json" );
+	} catch( daw::json::json_exception const &jex ) {
+		has_error = jex.reason_type( ) == daw::json::ErrorReason::UnknownEnumValue;
+	}
+	test_assert( has_error, "Expected an error for an unknown enumerator" );
+#endif
+	std::cout << "done\n";
+}
+#if defined( DAW_USE_EXCEPTIONS )
+catch( daw::json::json_exception const &jex ) {
+	std::cerr << "Exception thrown by parser: " << jex.reason( ) << '\n';
+	exit( 1 );
+} catch( std::exception const &ex ) {
+	std::cerr << "Unknown exception thrown during testing: " << ex.what( )
+	          << '\n';
+	exit( 1 );
+} catch( ... ) {
+	std::cerr << "Unknown exception thrown during testing\n";
+	throw;
+}
+#endif
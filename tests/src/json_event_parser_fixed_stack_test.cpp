@@ -0,0 +1,124 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#include "defines.h"
+
+#include <daw/json/daw_json_event_parser.h>
+#include <daw/json/daw_json_link.h>
+
+#include <cstddef>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <string_view>
+
+struct counting_handler {
+	std::size_t values = 0;
+	std::size_t max_depth = 0;
+	std::size_t depth = 0;
+
+	template<daw::json::json_options_t PolicyFlags, typename Allocator>
+	bool handle_on_value( daw::json::basic_json_pair<PolicyFlags, Allocator> ) {
+		++values;
+		return true;
+	}
+
+	template<daw::json::json_options_t PolicyFlags, typename Allocator>
+	bool
+	handle_on_array_start( daw::json::basic_json_value<PolicyFlags, Allocator> ) {
+		return start( );
+	}
+
+	template<daw::json::json_options_t PolicyFlags, typename Allocator>
+	bool
+	handle_on_class_start( daw::json::basic_json_value<PolicyFlags, Allocator> ) {
+		return start( );
+	}
+
+	bool handle_on_array_end( ) {
+		--depth;
+		return true;
+	}
+
+	bool handle_on_class_end( ) {
+		--depth;
+		return true;
+	}
+
+private:
+	bool start( ) {
+		++depth;
+		if( depth > max_depth ) {
+			max_depth = depth;
+		}
+		return true;
+	}
+};
+
+static constexpr std::string_view json_doc =
+  R"json({"a":[1,{"b":[2,3,{"c":null}]}],"d":"e"})json";
+
+void test_same_as_default( ) {
+	auto def_handler = counting_handler{ };
+	daw::json::json_event_parser( json_doc, def_handler );
+
+	auto fixed_handler = counting_handler{ };
+	daw::json::json_event_parser<daw::json::fixed_event_parser_stack<8>>(
+	  json_doc, fixed_handler );
+
+	test_assert( def_handler.values == fixed_handler.values,
+	             "Expected the same number of values" );
+	test_assert( fixed_handler.max_depth == 5, "Unexpected maximum depth" );
+	test_assert( fixed_handler.depth == 0, "Unbalanced start/end events" );
+}
+
+void test_exact_depth( ) {
+	auto handler = counting_handler{ };
+	daw::json::json_event_parser<daw::json::fixed_event_parser_stack<5>>(
+	  json_doc, handler );
+	test_assert( handler.max_depth == 5, "Unexpected maximum depth" );
+}
+
+void test_depth_exceeded( ) {
+#if defined( DAW_USE_EXCEPTIONS )
+	auto handler = counting_handler{ };
+	bool has_error = false;
+	try {
+		daw::json::json_event_parser<daw::json::fixed_event_parser_stack<4>>(
+		  json_doc, handler );
+	} catch( daw::json::json_exception const &jex ) {
+		has_error = jex.reason_type( ) ==
+		            daw::json::ErrorReason::MaxNestingDepthExceeded;
+	}
+	test_assert( has_error, "Expected the nesting depth to be exceeded" );
+#endif
+}
+
+int main( )
+#if defined( DAW_USE_EXCEPTIONS )
+  try
+#endif
+{
+	test_same_as_default( );
+	test_exact_depth( );
+	test_depth_exceeded( );
+	std::cout << "done\n";
+}
+#if defined( DAW_USE_EXCEPTIONS )
+catch( daw::json::json_exception const &jex ) {
+	std::cerr << "Exception thrown by parser: " << jex.reason( ) << '\n';
+	exit( 1 );
+} catch( std::exception const &ex ) {
+	std::cerr << "Unknown exception thrown during testing: " << ex.what( )
+	          << '\n';
+	exit( 1 );
+} catch( ... ) {
+	std::cerr << "Unknown exception thrown during testing\n";
+	throw;
+}
+#endif
@@ -0,0 +1,98 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+/// @brief Compares the default, allocating, stack policy of json_event_parser
+/// with fixed_event_parser_stack when parsing many small documents.
+
+#include "daw_json_benchmark.h"
+#include "defines.h"
+
+#include <daw/json/daw_json_event_parser.h>
+#include <daw/json/daw_json_link.h>
+
+#include <cstddef>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#if not defined( DAW_NUM_RUNS )
+#if not defined( DEBUG ) or defined( NDEBUG )
+static inline constexpr std::size_t DAW_NUM_RUNS = 250;
+#else
+static inline constexpr std::size_t DAW_NUM_RUNS = 2;
+#endif
+#endif
+static_assert( DAW_NUM_RUNS > 0 );
+
+struct value_count_handler {
+	std::size_t count = 0;
+
+	template<daw::json::json_options_t PolicyFlags, typename Allocator>
+	bool handle_on_value( daw::json::basic_json_pair<PolicyFlags, Allocator> ) {
+		++count;
+		return true;
+	}
+};
+
+static constexpr std::string_view small_doc =
+  R"json({"id":12345,"kind":"order","items":[{"sku":"a1","qty":2},{"sku":"b2","qty":1}],"meta":{"ok":true,"tags":["x","y"]}})json";
+
+template<typename StackPolicy>
+std::size_t count_values( std::vector<std::string> const &docs ) {
+	std::size_t result = 0;
+	for( auto const &doc : docs ) {
+		auto handler = value_count_handler{ };
+		daw::json::json_event_parser<StackPolicy>( doc, handler );
+		result += handler.count;
+	}
+	return result;
+}
+
+int main( )
+#if defined( DAW_USE_EXCEPTIONS )
+  try
+#endif
+{
+	constexpr std::size_t doc_count = 100'000;
+	auto const docs =
+	  std::vector<std::string>( doc_count, std::string( small_doc ) );
+	auto const total_size = doc_count * small_doc.size( );
+
+	auto const default_count = daw::json::benchmark::benchmark(
+	  DAW_NUM_RUNS, total_size, "event parser default stack",
+	  []( auto const &ds ) {
+		  return count_values<daw::use_default>( ds );
+	  },
+	  docs );
+	test_assert( default_count.has_value( ), "Unexpected error" );
+
+	auto const fixed_count = daw::json::benchmark::benchmark(
+	  DAW_NUM_RUNS, total_size, "event parser fixed stack",
+	  []( auto const &ds ) {
+		  return count_values<daw::json::fixed_event_parser_stack<16>>( ds );
+	  },
+	  docs );
+	test_assert( fixed_count.has_value( ), "Unexpected error" );
+	test_assert( fixed_count.get( ) == default_count.get( ),
+	             "Expected the same value count" );
+}
+#if defined( DAW_USE_EXCEPTIONS )
+catch( daw::json::json_exception const &jex ) {
+	std::cerr << "Exception thrown by parser: " << jex.reason( ) << '\n';
+	exit( 1 );
+} catch( std::exception const &ex ) {
+	std::cerr << "Unknown exception thrown during testing: " << ex.what( )
+	          << '\n';
+	exit( 1 );
+} catch( ... ) {
+	std::cerr << "Unknown exception thrown during testing\n";
+	throw;
+}
+#endif
@@ -0,0 +1,112 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#include "defines.h"
+
+#include <daw/json/daw_json_flat_map.h>
+#include <daw/json/daw_json_link.h>
+
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <tuple>
+
+namespace daw::flat_map_test {
+	struct Flags {
+		std::string name;
+		daw::json::json_flat_map<std::string, bool> flags;
+		daw::json::json_flat_map<std::string_view, int> limits;
+	};
+} // namespace daw::flat_map_test
+
+namespace daw::json {
+	template<>
+	struct json_data_contract<daw::flat_map_test::Flags> {
+		static constexpr char const name[] = "name";
+		static constexpr char const flags[] = "flags";
+		static constexpr char const limits[] = "limits";
+		using type = json_member_list<
+		  json_string<name>,
+		  json_key_value<flags, json_flat_map<std::string, bool>, bool>,
+		  json_key_value<limits, json_flat_map<std::string_view, int>, int,
+		                 std::string_view>>;
+
+		static auto to_json_data( daw::flat_map_test::Flags const &value ) {
+			return std::forward_as_tuple( value.name, value.flags, value.limits );
+		}
+	};
+} // namespace daw::json
+
+std::string make_large_doc( std::size_t count ) {
+	auto result = std::string( "{" );
+	for( std::size_t n = 0; n < count; ++n ) {
+		if( n > 0 ) {
+			result += ',';
+		}
+		result += "\"key" + std::to_string( n ) + "\":" + std::to_string( n );
+	}
+	result += '}';
+	return result;
+}
+
+int main( )
+#if defined( DAW_USE_EXCEPTIONS )
+  try
+#endif
+{
+	// limits and flags are out of order, so they are parsed with known bounds
+	static constexpr std::string_view json_doc = R"json(
+{
+	"limits": { "max": 10, "min": -2 },
+	"flags": { "a": true, "b": false, "a": false, "escaped\"key": true },
+	"name": "features"
+}
+)json";
+	auto const flags =
+	  daw::json::from_json<daw::flat_map_test::Flags>( json_doc );
+	test_assert( flags.name == "features", "Unexpected name" );
+	test_assert( flags.flags.size( ) == 3, "Unexpected flag count" );
+	test_assert( flags.flags.find( "a" )->second,
+	             "Expected the first of duplicate keys" );
+	test_assert( flags.flags.contains( "escaped\"key" ),
+	             "Expected an unescaped key" );
+	test_assert( flags.limits.find( "min" )->second == -2,
+	             "Unexpected limits.min" );
+	test_assert( flags.limits.begin( )->first == "max",
+	             "Expected insertion order" );
+
+	auto const str = daw::json::to_json( flags );
+	auto const flags2 = daw::json::from_json<daw::flat_map_test::Flags>( str );
+	test_assert( flags2.flags.size( ) == 3 and flags2.limits.size( ) == 2,
+	             "Unexpected round trip" );
+
+	constexpr std::size_t key_count = 10'000;
+	auto const large_doc = make_large_doc( key_count );
+	auto const large = daw::json::from_json<
+	  daw::json::json_key_value_no_name<daw::json::json_flat_map<std::string, int>,
+	                                    int>>( large_doc );
+	test_assert( large.size( ) == key_count, "Unexpected key count" );
+	test_assert( large.find( "key9999" )->second == 9999,
+	             "Unexpected value for key9999" );
+	test_assert( not large.contains( "key10000" ), "Unexpected key" );
+	std::cout << "done\n";
+}
+#if defined( DAW_USE_EXCEPTIONS )
+catch( daw::json::json_exception const &jex ) {
+	std::cerr << "Exception thrown by parser: " << jex.reason( ) << '\n';
+	exit( 1 );
+} catch( std::exception const &ex ) {
+	std::cerr << "Unknown exception thrown during testing: " << ex.what( )
+	          << '\n';
+	exit( 1 );
+} catch( ... ) {
+	std::cerr << "Unknown exception thrown during testing\n";
+	throw;
+}
+#endif
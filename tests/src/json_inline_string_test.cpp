@@ -0,0 +1,107 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#include "defines.h"
+
+#include <daw/json/daw_json_inline_string.h>
+#include <daw/json/daw_json_link.h>
+
+#include <cstdlib>
+#include <iostream>
+#include <string_view>
+#include <tuple>
+
+namespace daw::inline_string_test {
+	using id_t = daw::json::inline_string<8>;
+	using code_t =
+	  daw::json::inline_string<4, daw::json::FixedStringOverflow::Truncate>;
+
+	struct Item {
+		id_t id;
+		code_t code;
+	};
+} // namespace daw::inline_string_test
+
+namespace daw::json {
+	template<>
+	struct json_data_contract<daw::inline_string_test::Item> {
+		static constexpr char const id[] = "id";
+		static constexpr char const code[] = "code";
+		using type = json_member_list<
+		  json_inline_string<id, 8>,
+		  json_inline_string<code, 4, FixedStringOverflow::Truncate>>;
+
+		static auto to_json_data( daw::inline_string_test::Item const &value ) {
+			return std::forward_as_tuple( value.id, value.code );
+		}
+	};
+} // namespace daw::json
+
+int main( )
+#if defined( DAW_USE_EXCEPTIONS )
+  try
+#endif
+{
+	using daw::inline_string_test::Item;
+	static_assert( sizeof( daw::inline_string_test::id_t ) == 9 );
+
+	auto const items = daw::json::from_json_array<Item>( R"json(
+[
+	{ "id": "abcdefgh", "code": "ab" },
+	{ "id": "a\"b\\c", "code": "abcdef" },
+	{ "id": "été", "code": "abé" },
+	{ "id": "x", "code": "abcé" },
+	{ "id": "y", "code": "abc\u00e9" }
+]
+)json" );
+	test_assert( items.size( ) == 5, "Unexpected item count" );
+	test_assert( items[0].id == "abcdefgh", "Expected a string at capacity" );
+	test_assert( items[0].code == "ab", "Unexpected code" );
+	test_assert( items[1].id == "a\"b\\c", "Expected an unescaped string" );
+	test_assert( items[1].code == "abcd", "Expected a truncated string" );
+	test_assert( items[2].id == "\xC3\xA9t\xC3\xA9", "Expected a decoded string" );
+	test_assert( items[2].code == "ab\xC3\xA9", "Expected a decoded string" );
+	// Truncation does not split code points, escaped or not
+	test_assert( items[3].code == "abc", "Expected a whole code point" );
+	test_assert( items[4].code == "abc", "Expected a whole code point" );
+
+	auto const json_str = daw::json::to_json_array( items );
+	auto const items2 = daw::json::from_json_array<Item>( json_str );
+	test_assert( items2.size( ) == items.size( ), "Round trip failed" );
+	test_assert( items2[1].id == items[1].id and items2[2].id == items[2].id,
+	             "Round trip failed" );
+
+#if defined( DAW_USE_EXCEPTIONS )
+	for( std::string_view doc :
+	     { R"json({"id":"abcdefghi","code":""})json",
+	       R"json({"id":"abcdefg\n\n","code":""})json" } ) {
+		bool has_error = false;
+		try {
+			(void)daw::json::from_json<Item>( doc );
+		} catch( daw::json::json_exception const &jex ) {
+			has_error =
+			  jex.reason_type( ) == daw::json::ErrorReason::StringCapacityExceeded;
+		}
+		test_assert( has_error, "Expected an error for a string over capacity" );
+	}
+#endif
+	std::cout << "done\n";
+}
+#if defined( DAW_USE_EXCEPTIONS )
+catch( daw::json::json_exception const &jex ) {
+	std::cerr << "Exception thrown by parser: " << jex.reason( ) << '\n';
+	exit( 1 );
+} catch( std::exception const &ex ) {
+	std::cerr << "Unknown exception thrown during testing: " << ex.what( )
+	          << '\n';
+	exit( 1 );
+} catch( ... ) {
+	std::cerr << "Unknown exception thrown during testing\n";
+	throw;
+}
+#endif
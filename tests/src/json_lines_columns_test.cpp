@@ -0,0 +1,92 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#include "defines.h"
+
+#include <daw/json/daw_json_link.h>
+#include <daw/json/daw_json_lines_columns.h>
+
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <string_view>
+
+int main( )
+#if defined( DAW_USE_EXCEPTIONS )
+  try
+#endif
+{
+	constexpr daw::string_view json_lines_doc =
+	  R"jsonl({"ts":1,"level":"INFO","msg":"started","ctx":{"id":7,"tags":["a","b"]}}
+{"level":"ERROR","ts":2,"msg":"line\nbreak","ctx":{"id":8,"tags":["c"]},"extra":[1,2,3]}
+{"ts":3,"msg":null,"ctx":{"tags":[]}}
+{"ts":4,"level":"WARN","ts":5,"msg":"AB"}
+)jsonl";
+
+	auto ts = daw::json::json_number_column<std::int64_t>( "ts" );
+	auto level = daw::json::json_string_column( "level" );
+	auto msg = daw::json::json_string_column( "msg" );
+	auto id = daw::json::json_number_column<int>( "ctx.id" );
+	auto first_tag = daw::json::json_string_column( "ctx.tags[0]" );
+
+	daw::json::project_json_lines( json_lines_doc, ts, level, msg, id,
+	                               first_tag );
+
+	ensure( ts.size( ) == 4 );
+	ensure( level.size( ) == 4 );
+	ensure( msg.size( ) == 4 );
+	ensure( id.size( ) == 4 );
+	ensure( first_tag.size( ) == 4 );
+
+	// The first of duplicate members is used
+	ensure( ts[0] == 1 and ts[1] == 2 and ts[2] == 3 and ts[3] == 4 );
+
+	ensure( level[0] == "INFO" and level[1] == "ERROR" );
+	ensure( not level.is_present( 2 ) and level[2].empty( ) );
+	ensure( level[3] == "WARN" );
+
+	// Escaped strings are unescaped into the blob
+	ensure( msg[0] == "started" );
+	ensure( msg[1] == "line\nbreak" );
+	ensure( not msg.is_present( 2 ) );
+	ensure( msg[3] == "AB" );
+	ensure( msg.offsets( ).size( ) == 5 );
+	ensure( msg.blob( ) == std::string_view( "startedline\nbreakAB" ) );
+
+	ensure( id[0] == 7 and id[1] == 8 );
+	ensure( not id.is_present( 2 ) and not id.is_present( 3 ) );
+
+	ensure( first_tag[0] == "a" and first_tag[1] == "c" );
+	ensure( not first_tag.is_present( 2 ) and not first_tag.is_present( 3 ) );
+
+	// Projecting more records appends to the columns
+	daw::json::project_json_lines( R"({"ts":9})", ts );
+	ensure( ts.size( ) == 5 and ts[4] == 9 );
+
+	// The rest of a record is skipped once every column is found
+	daw::json::project_json_lines(
+	  R"({"ts":10,"rest":{"s":"}{\"]","a":[{},[]]},"ts":0}
+{"other":"}","ts":11})",
+	  ts );
+	ensure( ts.size( ) == 7 and ts[5] == 10 and ts[6] == 11 );
+	ts.clear( );
+	ensure( ts.size( ) == 0 );
+}
+#if defined( DAW_USE_EXCEPTIONS )
+catch( daw::json::json_exception const &jex ) {
+	std::cerr << "Exception thrown by parser: " << jex.reason( ) << '\n';
+	exit( 1 );
+} catch( std::exception const &ex ) {
+	std::cerr << "Unknown exception thrown during testing: " << ex.what( )
+	          << '\n';
+	exit( 1 );
+} catch( ... ) {
+	std::cerr << "Unknown exception thrown during testing\n";
+	throw;
+}
+#endif
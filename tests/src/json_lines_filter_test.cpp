@@ -0,0 +1,98 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#include "defines.h"
+
+#include <daw/json/daw_json_link.h>
+#include <daw/json/daw_json_lines_filter.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+struct LogRecord {
+	std::int64_t ts;
+	std::string level;
+	std::string msg;
+};
+
+namespace daw::json {
+	template<>
+	struct json_data_contract<LogRecord> {
+		static constexpr char const ts[] = "ts";
+		static constexpr char const level[] = "level";
+		static constexpr char const msg[] = "msg";
+		using type = json_member_list<json_link<ts, std::int64_t>,
+		                              json_link<level, std::string>,
+		                              json_link<msg, std::string>>;
+	};
+} // namespace daw::json
+
+int main( )
+#if defined( DAW_USE_EXCEPTIONS )
+  try
+#endif
+{
+	// The failing records are not valid LogRecords, so parsing them would throw
+	constexpr daw::string_view json_lines_doc =
+	  R"jsonl({"ts":1,"level":"INFO","msg":"started"}
+{"ts":2,"level":"ERROR","msg":"disk full"}
+
+{"ts":3,"level":"DEBUG","msg":false}
+   {"level":"ERROR","ts":4,"msg":"retry"}  
+{"ts":5,"msg":[1,2,3]}
+{"ts":6,"level":"ERROR","msg":"gave up"})jsonl";
+
+	auto is_error = []( daw::json::json_value const &record ) {
+		auto level = record["level"];
+		return level and level.get_string_view( ) == "ERROR";
+	};
+	auto errors = std::vector<LogRecord>( );
+	for( LogRecord const &r :
+	     daw::json::filter_json_lines<LogRecord>( json_lines_doc, is_error ) ) {
+		errors.push_back( r );
+	}
+	ensure( errors.size( ) == 3 );
+	ensure( errors[0].ts == 2 and errors[0].msg == "disk full" );
+	ensure( errors[1].ts == 4 and errors[1].msg == "retry" );
+	ensure( errors[2].ts == 6 and errors[2].msg == "gave up" );
+
+	// Predicates on more than one member
+	auto late_errors = daw::json::filter_json_lines<LogRecord>(
+	  json_lines_doc, [&]( daw::json::json_value const &record ) {
+		  return is_error( record ) and record["ts"].as<std::int64_t>( ) > 3;
+	  } );
+	std::size_t count = 0;
+	for( auto it = late_errors.begin( ); it != late_errors.end( ); ++it ) {
+		ensure( it->ts > 3 );
+		++count;
+	}
+	ensure( count == 2 );
+
+	auto none = daw::json::filter_json_lines<LogRecord>(
+	  json_lines_doc, []( daw::json::json_value const & ) {
+		  return false;
+	  } );
+	ensure( none.empty( ) );
+}
+#if defined( DAW_USE_EXCEPTIONS )
+catch( daw::json::json_exception const &jex ) {
+	std::cerr << "Exception thrown by parser: " << jex.reason( ) << '\n';
+	exit( 1 );
+} catch( std::exception const &ex ) {
+	std::cerr << "Unknown exception thrown during testing: " << ex.what( )
+	          << '\n';
+	exit( 1 );
+} catch( ... ) {
+	std::cerr << "Unknown exception thrown during testing\n";
+	throw;
+}
+#endif
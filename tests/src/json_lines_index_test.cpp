@@ -0,0 +1,155 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#include "defines.h"
+
+#include <daw/json/daw_json_link.h>
+#include <daw/json/daw_json_lines_index.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <vector>
+
+struct Event {
+	std::int64_t ts;
+	std::string msg;
+};
+
+namespace daw::json {
+	template<>
+	struct json_data_contract<Event> {
+		static constexpr char const ts[] = "ts";
+		static constexpr char const msg[] = "msg";
+		using type = json_member_list<json_link<ts, std::int64_t>,
+		                              json_link<msg, std::string>>;
+	};
+} // namespace daw::json
+
+int main( )
+#if defined( DAW_USE_EXCEPTIONS )
+  try
+#endif
+{
+	std::string json_lines_doc;
+	for( int n = 0; n < 10; ++n ) {
+		json_lines_doc += R"({"msg":"event )" + std::to_string( n ) +
+		                  R"(","ts":)" + std::to_string( n * 10 ) + "}\n";
+		if( n == 4 ) {
+			json_lines_doc += "\n";
+		}
+	}
+	auto const doc = daw::string_view( json_lines_doc );
+
+	auto opts = daw::json::json_lines_index_options{ };
+	opts.block_size = 3;
+	opts.key_path = "ts";
+	auto const index_data = daw::json::build_json_lines_index( doc, opts );
+	auto const index =
+	  daw::json::json_lines_index_view( index_data.data( ), index_data.size( ) );
+
+	ensure( index.record_count( ) == 10 );
+	ensure( index.block_count( ) == 4 );
+	ensure( index.document_size( ) == json_lines_doc.size( ) );
+	ensure( index.record( doc, 7 ) == R"({"msg":"event 7","ts":70})" );
+
+	// Random access
+	auto records = index.records<Event>( doc, 4, 6 );
+	auto events = std::vector<Event>( records.begin( ), records.end( ) );
+	ensure( events.size( ) == 2 );
+	ensure( events[0].ts == 40 and events[1].ts == 50 );
+
+	// Block min/max
+	ensure( index.block_key_min( 0 ) == 0.0 );
+	ensure( index.block_key_max( 0 ) == 20.0 );
+	ensure( index.block_key_min( 3 ) == 90.0 );
+	ensure( index.block_key_max( 3 ) == 90.0 );
+
+	// Only the blocks that can have 35 <= ts <= 55 are read
+	auto ranges = index.key_ranges<Event>( doc, 35.0, 55.0 );
+	ensure( ranges.size( ) == 1 );
+	std::size_t count = 0;
+	for( Event const &e : ranges[0] ) {
+		ensure( e.ts >= 30 and e.ts <= 50 );
+		++count;
+	}
+	ensure( count == 3 );
+	ensure( index.key_ranges<Event>( doc, 1000.0, 2000.0 ).empty( ) );
+
+	// Records appended after the index was built
+	json_lines_doc += R"({"msg":"late","ts":100})";
+	std::size_t late = 0;
+	for( Event const &e :
+	     index.unindexed_records<Event>( daw::string_view( json_lines_doc ) ) ) {
+		ensure( e.ts == 100 );
+		++late;
+	}
+	ensure( late == 1 );
+
+	// A file round trip
+	auto const index_path = std::string( "json_lines_index_test.jsonl.idx" );
+	daw::json::write_json_lines_index( index_path, index_data );
+	{
+		auto const index_file = daw::json::json_lines_index_file( index_path );
+		ensure( index_file->record_count( ) == 10 );
+		ensure( index_file->record( doc, 9 ) == R"({"msg":"event 9","ts":90})" );
+	}
+	(void)std::remove( index_path.c_str( ) );
+
+	// Corrupt indices are rejected
+	auto truncated = index_data;
+	truncated.pop_back( );
+	bool has_thrown = false;
+#if defined( DAW_USE_EXCEPTIONS )
+	try {
+		(void)daw::json::json_lines_index_view( truncated.data( ),
+		                                        truncated.size( ) );
+	} catch( daw::json::json_exception const & ) { has_thrown = true; }
+	ensure( has_thrown );
+
+	// Offsets that are out of order, or past the end of the document
+	auto const set_offset = []( std::vector<char> &data, std::size_t idx,
+	                            std::uint64_t offset ) {
+		std::memcpy( data.data( ) + 48U + idx * 8U, &offset, sizeof( offset ) );
+	};
+	auto const bad_offsets = std::vector<std::uint64_t>{
+	  0U, static_cast<std::uint64_t>( json_lines_doc.size( ) ) * 2U };
+	for( auto bad_offset : bad_offsets ) {
+		auto corrupt = index_data;
+		set_offset( corrupt, 5, bad_offset );
+		has_thrown = false;
+		try {
+			(void)daw::json::json_lines_index_view( corrupt.data( ),
+			                                        corrupt.size( ) );
+		} catch( daw::json::json_exception const &jex ) {
+			has_thrown = jex.reason_type( ) ==
+			             daw::json::ErrorReason::InvalidJSONLinesIndex;
+		}
+		ensure( has_thrown );
+	}
+#else
+	(void)has_thrown;
+#endif
+}
+#if defined( DAW_USE_EXCEPTIONS )
+catch( daw::json::json_exception const &jex ) {
+	std::cerr << "Exception thrown by parser: " << jex.reason( ) << '\n';
+	exit( 1 );
+} catch( std::exception const &ex ) {
+	std::cerr << "Unknown exception thrown during testing: " << ex.what( )
+	          << '\n';
+	exit( 1 );
+} catch( ... ) {
+	std::cerr << "Unknown exception thrown during testing\n";
+	throw;
+}
+#endif
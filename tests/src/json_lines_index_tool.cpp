@@ -0,0 +1,56 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+// Build a sidecar index for a JSON Lines file, written to <file>.idx
+//   json_lines_index_tool <file.jsonl> [key_path] [block_size]
+
+#include <daw/json/daw_json_lines_index.h>
+
+#include <daw/daw_memory_mapped_file.h>
+
+#include <cstdlib>
+#include <iostream>
+#include <string>
+
+int main( int argc, char **argv ) {
+	if( argc < 2 ) {
+		std::cerr << "Usage: " << argv[0]
+		          << " <file.jsonl> [key_path] [block_size]\n";
+		std::exit( EXIT_FAILURE );
+	}
+	auto const jsonl_doc = daw::filesystem::memory_mapped_file_t<char>( argv[1] );
+	auto opts = daw::json::json_lines_index_options{ };
+	if( argc > 2 ) {
+		opts.key_path = argv[2];
+	}
+	if( argc > 3 ) {
+		opts.block_size = std::stoul( argv[3] );
+	}
+	auto const index_path = std::string( argv[1] ) + ".idx";
+	auto const index = daw::json::build_json_lines_index(
+	  daw::string_view( std::data( jsonl_doc ), std::size( jsonl_doc ) ), opts );
+	daw::json::write_json_lines_index( index_path, index );
+
+	auto const index_file = daw::json::json_lines_index_file( index_path );
+	std::cout << index_path << ": " << index_file->record_count( )
+	          << " records in " << index_file->block_count( ) << " blocks of "
+	          << index_file->block_size( ) << '\n';
+	if( index_file->has_keys( ) and index_file->block_count( ) > 0 ) {
+		double key_min = index_file->block_key_min( 0 );
+		double key_max = index_file->block_key_max( 0 );
+		for( std::size_t b = 1; b < index_file->block_count( ); ++b ) {
+			if( index_file->block_key_min( b ) < key_min ) {
+				key_min = index_file->block_key_min( b );
+			}
+			if( index_file->block_key_max( b ) > key_max ) {
+				key_max = index_file->block_key_max( b );
+			}
+		}
+		std::cout << opts.key_path << " is in [" << key_min << ", " << key_max
+		          << "]\n";
+	}
+}
@@ -11,6 +11,7 @@
 #include <daw/json/daw_json_lines_iterator.h>
 #include <daw/json/daw_json_link.h>
 
+#include <cstddef>
 #include <iterator>
 #include <string>
 #include <tuple>
@@ -116,4 +117,37 @@ int main( ) {
 	for( auto jv : tp_range2 ) {
 		ensure( jv.is_array( ) );
 	}
+
+	// Balanced partitions with a long record and blank lines
+	auto json_lines3 = std::string( );
+	for( int n = 0; n < 100; ++n ) {
+		json_lines3 += R"({"a":)" + std::to_string( n ) + R"(,"b":true})" + '\n';
+		if( n == 10 ) {
+			json_lines3 += "[" + std::string( 10000, ' ' ) + "]\n";
+		}
+		if( n % 25 == 0 ) {
+			json_lines3 += "  \n";
+		}
+	}
+	for( std::size_t num_partitions = 1; num_partitions <= 8; ++num_partitions ) {
+		auto const partitions =
+		  daw::json::partition_jsonl_document_balanced( num_partitions,
+		                                                json_lines3 );
+		ensure( not partitions.empty( ) );
+		ensure( partitions.size( ) <= num_partitions );
+		std::size_t record_count = 0;
+		for( auto const &partition : partitions ) {
+			auto const count = static_cast<std::size_t>(
+			  std::distance( partition.begin( ), partition.end( ) ) );
+			ensure( count == partition.record_count );
+			record_count += count;
+		}
+		ensure( record_count == 101 );
+	}
+	auto const by_count = daw::json::partition_jsonl_document_balanced(
+	  4, json_lines3, daw::json::json_lines_partition_cost{ 1, 0 } );
+	ensure( by_count.size( ) == 4 );
+	for( auto const &partition : by_count ) {
+		ensure( partition.record_count >= 20 and partition.record_count <= 30 );
+	}
 }
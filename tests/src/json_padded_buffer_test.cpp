@@ -0,0 +1,113 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#include "defines.h"
+
+#include <daw/json/daw_json_link.h>
+#include <daw/json/daw_json_padded_buffer.h>
+
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+struct Message {
+	std::string from;
+	std::string text;
+	std::vector<int> tags;
+};
+
+namespace daw::json {
+	template<>
+	struct json_data_contract<Message> {
+		static constexpr char const from[] = "from";
+		static constexpr char const text[] = "text";
+		static constexpr char const tags[] = "tags";
+		using type = json_member_list<json_link<from, std::string>,
+		                              json_link<text, std::string>,
+		                              json_link<tags, std::vector<int>>>;
+	};
+} // namespace daw::json
+
+using simd_padded_policy = daw::json::BasicParsePolicy<
+  daw::json::options::parse_flags_t<
+    daw::json::options::ExecModeTypes::simd,
+    daw::json::options::PaddedInput::yes>::value>;
+static_assert( simd_padded_policy::is_padded_input );
+static_assert( std::is_same_v<simd_padded_policy::exec_tag_t,
+                              daw::json::simd_padded_exec_tag> );
+static_assert(
+  daw::json::is_padded_input_v<daw::json::json_padded_buffer> );
+
+void check( Message const &m ) {
+	ensure( m.from == "a \"quoted\" sender with a long name" );
+	ensure( m.text == "the text is longer than one block\\and ends here" );
+	ensure( m.tags == std::vector<int>{ 1, 2, 3 } );
+}
+
+int main( )
+#if defined( DAW_USE_EXCEPTIONS )
+  try
+#endif
+{
+	using namespace daw::json;
+	constexpr daw::string_view json_doc = R"json({
+		"from": "a \"quoted\" sender with a long name",
+		"text": "the text is longer than one block\\and ends here",
+		"tags": [1, 2, 3]
+	})json";
+
+	auto const buffer = json_padded_buffer( json_doc );
+	ensure( buffer.size( ) == json_doc.size( ) );
+	ensure( buffer.string_view( ) == json_doc );
+	for( std::size_t n = 0; n < json_padded_buffer::padding; ++n ) {
+		ensure( buffer.data( )[buffer.size( ) + n] == '\0' );
+	}
+
+	check( from_json<Message>( buffer ) );
+	check( from_json<Message>(
+	  buffer, options::parse_flags<options::ExecModeTypes::simd> ) );
+	check( from_json<Message>(
+	  buffer.string_view( ),
+	  options::parse_flags<options::ExecModeTypes::simd,
+	                       options::PaddedInput::yes> ) );
+
+	// The end of the document is inside the last block loaded
+	auto const short_doc = json_padded_buffer( daw::string_view( R"("abc")" ) );
+	ensure( from_json<std::string>(
+	          short_doc, options::parse_flags<options::ExecModeTypes::simd> ) ==
+	        "abc" );
+
+	auto const path = std::string( "json_padded_buffer_test.json" );
+	{
+		auto out = std::ofstream( path, std::ios::binary | std::ios::trunc );
+		out.write( std::data( json_doc ),
+		           static_cast<std::streamsize>( std::size( json_doc ) ) );
+	}
+	auto const file_buffer = read_json_padded_file( path );
+	(void)std::remove( path.c_str( ) );
+	ensure( file_buffer.string_view( ) == json_doc );
+	check( from_json<Message>(
+	  file_buffer, options::parse_flags<options::ExecModeTypes::simd> ) );
+}
+#if defined( DAW_USE_EXCEPTIONS )
+catch( daw::json::json_exception const &jex ) {
+	std::cerr << "Exception thrown by parser: " << jex.reason( ) << '\n';
+	exit( 1 );
+} catch( std::exception const &ex ) {
+	std::cerr << "Unknown exception thrown during testing: " << ex.what( )
+	          << '\n';
+	exit( 1 );
+} catch( ... ) {
+	std::cerr << "Unknown exception thrown during testing\n";
+	throw;
+}
+#endif
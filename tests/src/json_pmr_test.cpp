@@ -0,0 +1,125 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#include "defines.h"
+
+#include <daw/json/daw_json_link.h>
+#include <daw/json/daw_json_pmr.h>
+
+#include <cstdlib>
+#include <iostream>
+#include <string_view>
+#include <tuple>
+
+#if defined( DAW_JSON_HAS_PMR )
+#include <memory_resource>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace daw::pmr_test {
+	struct Tagged {
+		std::pmr::string name;
+		std::pmr::vector<std::pmr::string> tags;
+	};
+} // namespace daw::pmr_test
+
+namespace daw::json {
+	template<>
+	struct json_data_contract<daw::pmr_test::Tagged> {
+		static constexpr char const name[] = "name";
+		static constexpr char const tags[] = "tags";
+		using type = json_member_list<
+		  json_string<name, std::pmr::string>,
+		  json_array<tags, json_string_no_name<std::pmr::string>,
+		             std::pmr::vector<std::pmr::string>>>;
+
+		static auto to_json_data( daw::pmr_test::Tagged const &value ) {
+			return std::forward_as_tuple( value.name, value.tags );
+		}
+	};
+} // namespace daw::json
+
+int main( )
+#if defined( DAW_USE_EXCEPTIONS )
+  try
+#endif
+{
+	using daw::pmr_test::Tagged;
+	static constexpr std::string_view json_doc = R"json(
+[
+	{ "name": "a name that is longer than the small string buffer", "tags": [ "x", "a tag that is longer than the small string buffer" ] },
+	{ "name": "escaped \"name\" that is longer than the small string buffer", "tags": [ ] }
+]
+)json";
+
+	auto doc = daw::json::from_json_pmr<daw::json::json_array_no_name<
+	  Tagged, std::pmr::vector<Tagged>>>( json_doc );
+	auto *const resource = doc.resource( );
+	test_assert( resource != nullptr, "Expected a resource" );
+	test_assert( doc->size( ) == 2, "Unexpected element count" );
+	test_assert( doc->get_allocator( ).resource( ) == resource,
+	             "Expected the document's resource to be used" );
+	auto const &first = doc->front( );
+	test_assert( first.name.get_allocator( ).resource( ) == resource and
+	               first.tags.get_allocator( ).resource( ) == resource and
+	               first.tags[1].get_allocator( ).resource( ) == resource,
+	             "Expected members to use the document's resource" );
+	test_assert( doc.value( )[1].name ==
+	               "escaped \"name\" that is longer than the small string buffer",
+	             "Unexpected name" );
+
+	// The resource stays with the value when the document is moved
+	auto doc2 = std::move( doc );
+	test_assert( doc2.resource( ) == resource and doc.resource( ) == nullptr,
+	             "Expected the resource to move with the document" );
+	test_assert( doc2->front( ).tags[1] ==
+	               "a tag that is longer than the small string buffer",
+	             "Unexpected tag" );
+
+	auto opts = daw::json::json_pmr_options{ };
+	opts.buffer_ratio = 4.0;
+	auto const doc3 = daw::json::from_json_pmr<Tagged>(
+	  R"json({ "name": "single", "tags": [ "one" ] })json", opts );
+	test_assert( doc3->tags.size( ) == 1 and doc3->tags[0] == "one",
+	             "Unexpected tags" );
+#if defined( DAW_USE_EXCEPTIONS )
+	{
+		auto bad_opts = daw::json::json_pmr_options{ };
+		bad_opts.upstream = nullptr;
+		bool has_error = false;
+		try {
+			(void)daw::json::from_json_pmr<Tagged>(
+			  R"json({ "name": "x", "tags": [ ] })json", bad_opts );
+		} catch( daw::json::json_exception const &jex ) {
+			has_error =
+			  jex.reason_type( ) == daw::json::ErrorReason::InvalidPMROptions;
+		}
+		test_assert( has_error, "Expected an error for a null upstream" );
+	}
+#endif
+	std::cout << "done\n";
+}
+#if defined( DAW_USE_EXCEPTIONS )
+catch( daw::json::json_exception const &jex ) {
+	std::cerr << "Exception thrown by parser: " << jex.reason( ) << '\n';
+	exit( 1 );
+} catch( std::exception const &ex ) {
+	std::cerr << "Unknown exception thrown during testing: " << ex.what( )
+	          << '\n';
+	exit( 1 );
+} catch( ... ) {
+	std::cerr << "Unknown exception thrown during testing\n";
+	throw;
+}
+#endif
+#else
+int main( ) {
+	std::cout << "std::pmr is not available, skipping\n";
+}
+#endif
@@ -0,0 +1,126 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#include "defines.h"
+
+#include <daw/json/daw_json_link.h>
+#include <daw/json/daw_json_policy_profile.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+struct Reading {
+	std::int64_t sensor_identifier;
+	double temperature;
+	std::string location;
+
+	friend bool operator==( Reading const &lhs, Reading const &rhs ) {
+		return lhs.sensor_identifier == rhs.sensor_identifier and
+		       lhs.temperature == rhs.temperature and
+		       lhs.location == rhs.location;
+	}
+};
+
+namespace daw::json {
+	template<>
+	struct json_data_contract<Reading> {
+		static constexpr char const sensor_identifier[] = "sensor_identifier";
+		static constexpr char const temperature[] = "temperature";
+		static constexpr char const location[] = "location";
+		using type =
+		  json_member_list<json_link<sensor_identifier, std::int64_t>,
+		                   json_link<temperature, double>,
+		                   json_link<location, std::string>>;
+	};
+} // namespace daw::json
+
+int main( )
+#if defined( DAW_USE_EXCEPTIONS )
+  try
+#endif
+{
+	using namespace daw::json;
+	auto const minified = std::vector<std::string>{
+	  R"({"sensor_identifier":1,"temperature":21.5,"location":"lab"})",
+	  R"({"sensor_identifier":2,"temperature":-3.25,"location":"roof"})" };
+
+	auto const profile = profile_json_documents( minified );
+	ensure( profile.document_count == 2 );
+	ensure( not profile.has_whitespace and not profile.has_comments( ) );
+	ensure( not profile.has_escaped_names );
+	ensure( profile.name_count == 6 and profile.max_name_size == 17 );
+
+	auto const selection = select_parse_policy<Reading>( minified );
+	ensure( selection.has_selection( ) );
+	ensure( selection.results[selection.index].is_correct );
+	// Minified without comments, so every default candidate can be used
+	for( auto const &result : selection.results ) {
+		ensure( result.is_compatible and result.is_correct );
+	}
+
+	auto const dispatcher = json_policy_dispatcher<Reading>( selection );
+	ensure( dispatcher.index( ) == selection.index );
+	ensure( not dispatcher.description( ).empty( ) );
+	ensure( dispatcher.parse( minified[1] ) == Reading{ 2, -3.25, "roof" } );
+
+	auto const pretty = std::vector<std::string>{
+	  "{\n  \"sensor_identifier\": 3,\n  \"temperature\": 1.0,\n"
+	  "  \"location\": \"hall\" // front\n}" };
+	using candidates = json_policy_candidates<
+	  options::parse_flags_t<>,
+	  options::parse_flags_t<options::MinifiedDocument::yes>,
+	  options::parse_flags_t<options::PolicyCommentTypes::cpp>,
+	  options::parse_flags_t<options::PolicyCommentTypes::cpp,
+	                         options::ExpectLongNames::yes>,
+	  options::parse_flags_t<options::PolicyCommentTypes::cpp,
+	                         options::ZeroTerminatedString::yes>>;
+	auto const pretty_selection =
+	  select_parse_policy<Reading, candidates>( pretty );
+	ensure( pretty_selection.profile.has_whitespace );
+	ensure( pretty_selection.profile.has_cpp_comments );
+	ensure( not pretty_selection.results[0].is_compatible );
+	ensure( not pretty_selection.results[1].is_compatible );
+	ensure( pretty_selection.results[2].is_correct );
+	ensure( pretty_selection.results[3].is_correct );
+	ensure( not pretty_selection.results[4].is_compatible );
+	ensure( pretty_selection.index == 2 or pretty_selection.index == 3 );
+	ensure( describe_policy_candidate<candidates>( 3 ) ==
+	        "ExecModeTypes::compile_time, ExpectLongNames::yes, "
+	        "PolicyCommentTypes::cpp" );
+
+	auto const pretty_dispatcher =
+	  json_policy_dispatcher<Reading, candidates>( pretty_selection );
+	ensure( pretty_dispatcher.parse( pretty[0] ) == Reading{ 3, 1.0, "hall" } );
+
+	auto const zero_terminated_selection =
+	  select_parse_policy<Reading, candidates>(
+	    pretty, json_policy_selection_options{ 1, true } );
+	ensure( zero_terminated_selection.results[4].is_correct );
+
+	using minified_only = json_policy_candidates<
+	  options::parse_flags_t<options::MinifiedDocument::yes>>;
+	ensure( not select_parse_policy<Reading, minified_only>( pretty )
+	              .has_selection( ) );
+}
+#if defined( DAW_USE_EXCEPTIONS )
+catch( daw::json::json_exception const &jex ) {
+	std::cerr << "Exception thrown by parser: " << jex.reason( ) << '\n';
+	exit( 1 );
+} catch( std::exception const &ex ) {
+	std::cerr << "Unknown exception thrown during testing: " << ex.what( )
+	          << '\n';
+	exit( 1 );
+} catch( ... ) {
+	std::cerr << "Unknown exception thrown during testing\n";
+	throw;
+}
+#endif
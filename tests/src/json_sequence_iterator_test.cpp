@@ -0,0 +1,90 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#include "defines.h"
+
+#include <daw/json/daw_json_link.h>
+#include <daw/json/daw_json_sequence_iterator.h>
+
+#include <cstddef>
+#include <string>
+#include <tuple>
+#include <vector>
+
+struct Element {
+	int a;
+	std::string s;
+};
+
+namespace daw::json {
+	template<>
+	struct json_data_contract<Element> {
+		static constexpr char const a[] = "a";
+		static constexpr char const s[] = "s";
+		using type = json_member_list<json_link<a, int>, json_link<s, std::string>>;
+
+		static constexpr auto to_json_data( Element const &e ) {
+			return std::forward_as_tuple( e.a, e.s );
+		}
+	};
+} // namespace daw::json
+
+int main( ) {
+	// Concatenated values, some only separated by whitespace and with brackets
+	// in strings
+	constexpr daw::string_view json_sequence =
+	  R"json({"a":1,"s":"}{"}{"a":2,"s":"x"} {"a":3,"s":"]"}	{"a":4,"s":""}
+{"a":5,"s":"\"{"}{"a":6,"s":"y"})json";
+
+	auto range = daw::json::json_sequence_range<Element>( json_sequence );
+	auto elements = std::vector<Element>( range.begin( ), range.end( ) );
+	ensure( elements.size( ) == 6 );
+	for( std::size_t n = 0; n < elements.size( ); ++n ) {
+		ensure( elements[n].a == static_cast<int>( n + 1 ) );
+	}
+	ensure( elements[0].s == "}{" );
+	ensure( elements[4].s == "\"{" );
+
+	for( std::size_t num_partitions = 1; num_partitions <= 8; ++num_partitions ) {
+		auto partitions =
+		  daw::json::partition_json_sequence_document<Element>( num_partitions,
+		                                                        json_sequence );
+		ensure( not partitions.empty( ) );
+		ensure( partitions.size( ) <= num_partitions );
+		int expected = 1;
+		for( auto const &partition : partitions ) {
+			ensure( not partition.empty( ) );
+			for( Element const &e : partition ) {
+				ensure( e.a == expected );
+				++expected;
+			}
+		}
+		ensure( expected == 7 );
+	}
+
+	// Scalars need whitespace between them
+	constexpr daw::string_view numbers = "1 2\n3\t4 [5] \"6\"";
+	auto values = std::vector<int>( );
+	for( auto jv : daw::json::json_sequence_range<>( numbers ) ) {
+		if( jv.is_number( ) ) {
+			values.push_back( jv.as<int>( ) );
+		}
+	}
+	ensure( values.size( ) == 4 );
+	ensure( values[3] == 4 );
+	auto number_partitions =
+	  daw::json::partition_json_sequence_document( 3, numbers );
+	std::size_t count = 0;
+	for( auto const &partition : number_partitions ) {
+		for( auto jv : partition ) {
+			(void)jv;
+			++count;
+		}
+	}
+	ensure( count == 6 );
+}
@@ -0,0 +1,102 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#include "defines.h"
+
+#include <daw/json/daw_json_link.h>
+#include <daw/json/daw_json_string_intern.h>
+
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <vector>
+
+namespace daw::string_intern_test {
+	struct Event {
+		std::string_view type;
+		std::string_view country;
+		int id;
+	};
+} // namespace daw::string_intern_test
+
+namespace daw::json {
+	template<>
+	struct json_data_contract<daw::string_intern_test::Event> {
+		static constexpr char const type[] = "type";
+		static constexpr char const country[] = "country";
+		static constexpr char const id[] = "id";
+		using type = json_member_list<json_interned_string<type>,
+		                              json_interned_string<country>,
+		                              json_number<id, int>>;
+
+		static auto to_json_data( daw::string_intern_test::Event const &value ) {
+			return std::forward_as_tuple( value.type, value.country, value.id );
+		}
+	};
+} // namespace daw::json
+
+int main( )
+#if defined( DAW_USE_EXCEPTIONS )
+  try
+#endif
+{
+	using daw::string_intern_test::Event;
+	static constexpr std::string_view json_doc = R"json(
+[
+	{ "type": "click", "country": "CA", "id": 1 },
+	{ "type": "view", "country": "CA", "id": 2 },
+	{ "type": "click", "country": "US", "id": 3 },
+	{ "type": "cl\u0069ck", "country": "", "id": 4 }
+]
+)json";
+
+	auto pool = daw::json::json_string_intern_pool( );
+	auto events = std::vector<Event>( );
+	{
+		auto const scope = daw::json::json_string_intern_scope( pool );
+		events = daw::json::from_json_array<Event>( json_doc );
+	}
+	test_assert( events.size( ) == 4, "Unexpected event count" );
+	test_assert( pool.size( ) == 4, "Expected 4 distinct strings in the pool" );
+	test_assert( events[0].type == "click" and events[1].type == "view",
+	             "Unexpected type" );
+	test_assert( events[1].country == "CA", "Expected an unescaped string" );
+	test_assert( events[3].country.empty( ), "Expected an empty string" );
+	// Equal strings, escaped or not, share one copy
+	test_assert( events[0].type.data( ) == events[2].type.data( ) and
+	               events[0].type.data( ) == events[3].type.data( ),
+	             "Expected equal strings to be shared" );
+	test_assert( events[0].country.data( ) == events[1].country.data( ),
+	             "Expected equal strings to be shared" );
+	test_assert( daw::json::thread_string_intern_pool( ).size( ) == 0,
+	             "Expected the scope's pool to be used" );
+
+	auto const json_str = daw::json::to_json_array( events );
+	auto const events2 = daw::json::from_json_array<Event>( json_str );
+	test_assert( events2.size( ) == events.size( ), "Round trip failed" );
+	test_assert( events2[1].country == "CA" and events2[2].type == "click",
+	             "Round trip failed" );
+	test_assert( daw::json::thread_string_intern_pool( ).size( ) == 4,
+	             "Expected the thread's pool without a scope" );
+	std::cout << "json_string_intern_test passed\n";
+}
+#if defined( DAW_USE_EXCEPTIONS )
+catch( daw::json::json_exception const &jex ) {
+	std::cerr << "Exception thrown by parser: " << jex.reason( ) << '\n';
+	exit( 1 );
+} catch( std::exception const &ex ) {
+	std::cerr << "Unknown exception thrown during testing: " << ex.what( )
+	          << '\n';
+	exit( 1 );
+} catch( ... ) {
+	std::cerr << "Unknown exception thrown during testing\n";
+	throw;
+}
+#endif
@@ -0,0 +1,150 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#include "defines.h"
+
+#include <daw/json/daw_json_link.h>
+#include <daw/json/daw_json_token_cursor.h>
+
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+static constexpr std::string_view json_doc = R"json(
+{
+	"id": 42,
+	"name": "a\nb",
+	"ok": true,
+	"none": null,
+	"values": [ 1.5, -2, [ ] ],
+	"skipped": { "a": [ 1, 2, { "b": 3 } ] },
+	"point": [ 1, 2, 3 ],
+	"last": { }
+}
+)json";
+
+using daw::json::JsonTokenTypes;
+
+void test_tokens( ) {
+	auto cursor = daw::json::json_token_cursor( json_doc );
+	test_assert( cursor.token( ) == JsonTokenTypes::None,
+	             "Expected no token before the first read" );
+	test_assert( cursor.next_token( ) == JsonTokenTypes::ClassStart,
+	             "Expected class start" );
+	test_assert( not cursor.current_key( ), "Root has no key" );
+
+	test_assert( cursor.next_token( ) == JsonTokenTypes::Number,
+	             "Expected number" );
+	test_assert( cursor.current_key( ) == "id", "Expected id" );
+	test_assert( cursor.get_number<int>( ) == 42, "Unexpected id" );
+	test_assert( cursor.get_string_view( ) == "42", "Unexpected raw id" );
+	test_assert( cursor.depth( ) == 1, "Unexpected depth" );
+
+	test_assert( cursor.next_token( ) == JsonTokenTypes::String,
+	             "Expected string" );
+	test_assert( cursor.current_key( ) == "name", "Expected name" );
+	test_assert( cursor.get_string_view( ) == R"(a\nb)",
+	             "Unexpected raw string" );
+	test_assert( cursor.get_string( ) == "a\nb", "Unexpected unescaped string" );
+
+	test_assert( cursor.next_token( ) == JsonTokenTypes::Bool, "Expected bool" );
+	test_assert( cursor.get_bool( ), "Expected true" );
+	test_assert( cursor.next_token( ) == JsonTokenTypes::Null, "Expected null" );
+	test_assert( cursor.current_key( ) == "none", "Expected none" );
+
+	test_assert( cursor.next_token( ) == JsonTokenTypes::ArrayStart,
+	             "Expected array start" );
+	test_assert( cursor.current_key( ) == "values", "Expected values" );
+	test_assert( cursor.next_token( ) == JsonTokenTypes::Number,
+	             "Expected number" );
+	test_assert( not cursor.current_key( ), "Array elements have no key" );
+	test_assert( cursor.get_number( ) == 1.5, "Unexpected values[0]" );
+	test_assert( cursor.next_token( ) == JsonTokenTypes::Number,
+	             "Expected number" );
+	test_assert( cursor.get_number<int>( ) == -2, "Unexpected values[1]" );
+	test_assert( cursor.next_token( ) == JsonTokenTypes::ArrayStart,
+	             "Expected array start" );
+	test_assert( cursor.next_token( ) == JsonTokenTypes::ArrayEnd,
+	             "Expected empty array end" );
+	test_assert( cursor.next_token( ) == JsonTokenTypes::ArrayEnd,
+	             "Expected array end" );
+
+	test_assert( cursor.next_token( ) == JsonTokenTypes::ClassStart,
+	             "Expected class start" );
+	test_assert( cursor.current_key( ) == "skipped", "Expected skipped" );
+	cursor.skip( );
+	test_assert( cursor.token( ) == JsonTokenTypes::ClassEnd,
+	             "Skipping a class leaves the cursor at its end" );
+	test_assert( cursor.depth( ) == 1, "Unexpected depth after skip" );
+
+	test_assert( cursor.next_token( ) == JsonTokenTypes::ArrayStart,
+	             "Expected array start" );
+	auto const point = cursor.get_value<std::vector<int>>( );
+	test_assert( point == std::vector<int>{ 1, 2, 3 }, "Unexpected point" );
+	test_assert( cursor.token( ) == JsonTokenTypes::ArrayEnd,
+	             "Parsing an array leaves the cursor at its end" );
+
+	test_assert( cursor.next_token( ) == JsonTokenTypes::ClassStart,
+	             "Expected class start" );
+	test_assert( cursor.next_token( ) == JsonTokenTypes::ClassEnd,
+	             "Expected empty class end" );
+	test_assert( cursor.next_token( ) == JsonTokenTypes::ClassEnd,
+	             "Expected root class end" );
+	test_assert( cursor.depth( ) == 0, "Unexpected final depth" );
+	test_assert( cursor.next_token( ) == JsonTokenTypes::None,
+	             "Expected end of document" );
+	test_assert( cursor.is_done( ), "Expected the cursor to be done" );
+}
+
+void test_scalar_root( ) {
+	auto cursor = daw::json::json_token_cursor( R"( "hello" )" );
+	test_assert( cursor.next_token( ) == JsonTokenTypes::String,
+	             "Expected string" );
+	test_assert( cursor.get_string_view( ) == "hello", "Unexpected string" );
+	test_assert( cursor.next_token( ) == JsonTokenTypes::None,
+	             "Expected end of document" );
+}
+
+void test_sum_numbers( ) {
+	// Sum every number without building any json_value's
+	auto cursor = daw::json::json_token_cursor( json_doc );
+	double sum = 0.0;
+	while( cursor.next_token( ) != JsonTokenTypes::None ) {
+		if( cursor.token( ) == JsonTokenTypes::Number ) {
+			sum += cursor.get_number( );
+		}
+	}
+	// 42 + 1.5 - 2 + ( 1 + 2 + 3 ) + ( 1 + 2 + 3 )
+	test_assert( sum == 53.5, "Unexpected sum" );
+}
+
+int main( )
+#if defined( DAW_USE_EXCEPTIONS )
+  try
+#endif
+{
+	test_tokens( );
+	test_scalar_root( );
+	test_sum_numbers( );
+	std::cout << "done\n";
+}
+#if defined( DAW_USE_EXCEPTIONS )
+catch( daw::json::json_exception const &jex ) {
+	std::cerr << "Exception thrown by parser: " << jex.reason( ) << '\n';
+	exit( 1 );
+} catch( std::exception const &ex ) {
+	std::cerr << "Unknown exception thrown during testing: " << ex.what( )
+	          << '\n';
+	exit( 1 );
+} catch( ... ) {
+	std::cerr << "Unknown exception thrown during testing\n";
+	throw;
+}
+#endif
@@ -0,0 +1,131 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+/// @brief Parses the records of cookbook_variant1.json, the cookbook input
+/// with untagged variants, repeated into a large array to measure the
+/// dispatch on the first byte of each variant value.
+/// Usage: json_variant_dispatch_bench <path to cookbook_variant1.json>
+
+#include "daw_json_benchmark.h"
+#include "defines.h"
+
+#include <daw/daw_read_file.h>
+#include <daw/json/daw_json_link.h>
+
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <variant>
+#include <vector>
+
+#if not defined( DAW_NUM_RUNS )
+#if not defined( DEBUG ) or defined( NDEBUG )
+static inline constexpr std::size_t DAW_NUM_RUNS = 250;
+#else
+static inline constexpr std::size_t DAW_NUM_RUNS = 2;
+#endif
+#endif
+static_assert( DAW_NUM_RUNS > 0 );
+
+namespace daw::cookbook_variant1 {
+	struct SomeClass {};
+
+	struct MyVariantStuff1 {
+		std::variant<int, std::string, bool, SomeClass, std::vector<int>> member0;
+		std::variant<std::string, bool> member1;
+	};
+} // namespace daw::cookbook_variant1
+
+namespace daw::json {
+	template<>
+	struct json_data_contract<daw::cookbook_variant1::SomeClass> {
+		using type = json_member_list<>;
+	};
+
+	template<>
+	struct json_data_contract<daw::cookbook_variant1::MyVariantStuff1> {
+		static constexpr char const member0[] = "member0";
+		static constexpr char const member1[] = "member1";
+		using type = json_member_list<
+		  json_variant<
+		    member0,
+		    std::variant<int, std::string, bool, daw::cookbook_variant1::SomeClass,
+		                 std::vector<int>>,
+		    json_variant_type_list<int, std::string, bool,
+		                           daw::cookbook_variant1::SomeClass,
+		                           std::vector<int>>>,
+		  json_variant<member1, std::variant<std::string, bool>>>;
+	};
+} // namespace daw::json
+
+/// @brief An array of the elements of json_array repeated count times
+std::string repeat_array_elements( std::string_view json_array,
+                                   std::size_t count ) {
+	auto const first = json_array.find( '[' );
+	auto const last = json_array.rfind( ']' );
+	test_assert( first != std::string_view::npos and
+	               last != std::string_view::npos and first < last,
+	             "Expected a JSON array" );
+	auto const elements = json_array.substr( first + 1, last - first - 1 );
+	auto result = std::string( "[" );
+	for( std::size_t n = 0; n < count; ++n ) {
+		if( n > 0 ) {
+			result += ',';
+		}
+		result += elements;
+	}
+	result += ']';
+	return result;
+}
+
+int main( int argc, char **argv )
+#if defined( DAW_USE_EXCEPTIONS )
+  try
+#endif
+{
+	if( argc <= 1 ) {
+		puts( "Must supply path to cookbook_variant1.json file\n" );
+		exit( EXIT_FAILURE );
+	}
+	using daw::cookbook_variant1::MyVariantStuff1;
+	auto const data = daw::read_file( argv[1] ).value( );
+	auto const records = daw::json::from_json_array<MyVariantStuff1>( data );
+	test_assert( not records.empty( ), "Expected records" );
+
+	constexpr std::size_t repeat_count = 25'000;
+	auto const json_doc = repeat_array_elements( data, repeat_count );
+	auto const result = daw::json::benchmark::benchmark(
+	  DAW_NUM_RUNS, json_doc.size( ), "cookbook_variant1 untagged variants",
+	  []( auto const &doc ) {
+		  return daw::json::from_json_array<MyVariantStuff1>( doc );
+	  },
+	  json_doc );
+	test_assert( result.has_value( ), "Unexpected error" );
+	test_assert( result.get( ).size( ) == records.size( ) * repeat_count,
+	             "Unexpected size" );
+	test_assert( result.get( ).back( ).member0.index( ) ==
+	               records.back( ).member0.index( ),
+	             "Unexpected alternative" );
+	std::cout << "done\n";
+}
+#if defined( DAW_USE_EXCEPTIONS )
+catch( daw::json::json_exception const &jex ) {
+	std::cerr << "Exception thrown by parser: " << jex.reason( ) << '\n';
+	exit( 1 );
+} catch( std::exception const &ex ) {
+	std::cerr << "Unknown exception thrown during testing: " << ex.what( )
+	          << '\n';
+	exit( 1 );
+} catch( ... ) {
+	std::cerr << "Unknown exception thrown during testing\n";
+	throw;
+}
+#endif
@@ -6,22 +6,40 @@
 // Official repository: https://github.com/beached/daw_json_link.h
 //
 
+#include <daw/json/concepts/daw_writable_output_buffered.h>
 #include <daw/json/daw_from_json.h>
 #include <daw/json/daw_from_json_fwd.h>
+#include <daw/json/daw_json_aggregate.h>
+#include <daw/json/daw_json_array_index.h>
+#include <daw/json/daw_json_async_generator.h>
 #include <daw/json/daw_json_data_contract.h>
 #include <daw/json/daw_json_default_constuctor_fwd.h>
+#include <daw/json/daw_json_document_index.h>
+#include <daw/json/daw_json_enum_string.h>
 #include <daw/json/daw_json_event_parser.h>
 #include <daw/json/daw_json_exception.h>
 #include <daw/json/daw_json_find_path.h>
+#include <daw/json/daw_json_find_paths.h>
+#include <daw/json/daw_json_flat_map.h>
+#include <daw/json/daw_json_inline_string.h>
 #include <daw/json/daw_json_iostream.h>
 #include <daw/json/daw_json_iterator.h>
+#include <daw/json/daw_json_lines_columns.h>
+#include <daw/json/daw_json_lines_filter.h>
+#include <daw/json/daw_json_lines_index.h>
 #include <daw/json/daw_json_lines_iterator.h>
 #include <daw/json/daw_json_link.h>
 #include <daw/json/daw_json_link_types.h>
+#include <daw/json/daw_json_padded_buffer.h>
 #include <daw/json/daw_json_parse_options.h>
+#include <daw/json/daw_json_pmr.h>
+#include <daw/json/daw_json_policy_profile.h>
 #include <daw/json/daw_json_schema.h>
+#include <daw/json/daw_json_sequence_iterator.h>
 #include <daw/json/daw_json_serialize_options.h>
+#include <daw/json/daw_json_string_intern.h>
 #include <daw/json/daw_json_switches.h>
+#include <daw/json/daw_json_token_cursor.h>
 #include <daw/json/daw_json_value_state.h>
 #include <daw/json/daw_to_json.h>
 #include <daw/json/daw_to_json_fwd.h>
@@ -8,12 +8,26 @@
 
 #include "defines.h"
 
+#include "daw_json_benchmark.h"
+
+#include "daw/json/concepts/daw_writable_output_buffered.h"
 #include "daw/json/daw_json_link.h"
 
+#include <cstddef>
 #include <cstdio>
 #include <cstdlib>
 #include <iostream>
+#include <sstream>
 #include <string>
+#include <vector>
+
+#if not defined( DAW_NUM_RUNS )
+#if not defined( DEBUG ) or defined( NDEBUG )
+static inline constexpr std::size_t DAW_NUM_RUNS = 100;
+#else
+static inline constexpr std::size_t DAW_NUM_RUNS = 2;
+#endif
+#endif
 
 namespace daw::cookbook_class1 {
 	struct MyClass1 {
@@ -77,6 +91,48 @@ int main( int, char ** )
 	(void)daw::json::to_json( cls, it );
 	std::string const str = ss.str( );
 	puts( str.c_str( ) );
+
+	// Each piece written to an ostream is a call through the streambuf.  The
+	// buffered writer hands it whole chunks instead
+	auto const values = std::vector<daw::cookbook_class1::MyClass1>(
+	  10'000, daw::cookbook_class1::MyClass1{ "this is a test", 314159, true } );
+
+	std::string unbuffered_str{ };
+	std::string buffered_str{ };
+	auto const data_size = ( str.size( ) + 1U ) * values.size( );
+
+	(void)daw::json::benchmark::benchmark(
+	  DAW_NUM_RUNS, data_size, "ostream output",
+	  [&]( auto const &v ) {
+		  std::stringstream out{ };
+		  for( auto const &value : v ) {
+			  (void)daw::json::to_json( value, out );
+			  out.put( '\n' );
+		  }
+		  unbuffered_str = out.str( );
+	  },
+	  values );
+
+	(void)daw::json::benchmark::benchmark(
+	  DAW_NUM_RUNS, data_size, "buffered ostream output",
+	  [&]( auto const &v ) {
+		  std::stringstream out{ };
+		  {
+			  auto writer = daw::json::buffered_ostream_writer(
+			    daw::json::json_streambuf_sink( out ) );
+			  for( auto const &value : v ) {
+				  (void)daw::json::to_json( value, writer );
+				  daw::json::put_output( writer, '\n' );
+			  }
+			  writer.flush( );
+		  }
+		  buffered_str = out.str( );
+	  },
+	  values );
+
+	test_assert( unbuffered_str.size( ) == data_size, "Unexpected size" );
+	test_assert( buffered_str == unbuffered_str,
+	             "Buffered output does not match ostream output" );
 }
 #if defined( DAW_USE_EXCEPTIONS )
 catch( daw::json::json_exception const &jex ) {
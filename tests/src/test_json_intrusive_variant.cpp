@@ -133,6 +133,32 @@ int main( ) {
 	auto const cv1b = daw::json::from_json<ConfigV1>( json_doc_v1b );
 	daw_ensure( cv1 == cv1b );
 
+	// The version member does not have to be first.  Members before it are kept
+	// for the selected alternative and unknown members are skipped
+	static constexpr daw::string_view json_doc_v2_tag_last = R"json(
+{
+	"flag1": true,
+	"unknown": { "a": [ 1, 2, 3 ] },
+	"flag2": false,
+	"path": "/path/to/thing",
+	"flag3": false,
+	"version": 2,
+	"flag4": true
+}
+)json";
+
+	static constexpr daw::string_view json_doc_v1_tag_last = R"json(
+{
+	"flag": true,
+	"file": "/path/to/thing",
+	"version": 1
+}
+)json";
+
+	auto const c1_tag_last = daw::json::from_json<Config>( json_doc_v1_tag_last );
+	daw_ensure( c1_tag_last.index( ) == 0 );
+	daw_ensure( std::get<0>( c1_tag_last ) == cv1 );
+
 	auto const c2 = daw::json::from_json<Config>( json_doc_v2 );
 	auto const cv2 = daw::json::from_json<ConfigV2>( json_doc_v2 );
 	daw_ensure( c2.index( ) == 1 );
@@ -144,4 +170,8 @@ int main( ) {
 	  [&cv2]( ConfigV2 const &a ) -> bool {
 		  return a == cv2;
 	  } ) );
+
+	auto const c2_tag_last = daw::json::from_json<Config>( json_doc_v2_tag_last );
+	daw_ensure( c2_tag_last.index( ) == 1 );
+	daw_ensure( std::get<1>( c2_tag_last ) == cv2 );
 }
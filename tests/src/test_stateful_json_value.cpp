@@ -16,6 +16,7 @@
 
 #include <cstdlib>
 #include <iostream>
+#include <string>
 
 struct coordinate_t {
 	double x;
@@ -51,6 +52,36 @@ coordinate_t calc( std::string_view text ) {
 	return coordinate_t{ x / len, y / len, z / len };
 }
 
+void test_hashed_dictionary( ) {
+	using namespace daw::json;
+	constexpr int key_count = 2000;
+	auto doc = std::string( "{" );
+	for( int n = 0; n < key_count; ++n ) {
+		doc += "\"key" + std::to_string( n ) + "\":" + std::to_string( n ) + ",";
+	}
+	// Duplicates must resolve to the first occurrence
+	doc += R"("key0":-1})";
+
+	auto state =
+	  hashed_json_value_state( basic_json_value( std::string_view( doc ) ) );
+	// Lookup from the back first so that the whole class is indexed
+	for( int n = key_count - 1; n >= 0; --n ) {
+		auto const key = "key" + std::to_string( n );
+		test_assert( from_json<int>( state[key] ) == n, "Unexpected value" );
+	}
+	for( int n = 0; n < key_count; ++n ) {
+		auto const key = "key" + std::to_string( n );
+		test_assert( state.index_of( key ) == static_cast<std::size_t>( n ),
+		             "Unexpected index" );
+	}
+	test_assert( not state.contains( "missing" ), "Unexpected member" );
+	test_assert( state.size( ) == key_count + 1, "Unexpected member count" );
+
+	state.reset( basic_json_value( R"({"a":1,"b":2})" ) );
+	test_assert( from_json<int>( state["b"] ) == 2, "Unexpected value" );
+	test_assert( not state.contains( "key5" ), "Expected reset index" );
+}
+
 int main( int argc, char **argv )
 #if defined( DAW_USE_EXCEPTIONS )
   try
@@ -60,6 +91,7 @@ int main( int argc, char **argv )
 		std::cout << "Must supply path to test_stateful_json_value.json file\n";
 		exit( EXIT_FAILURE );
 	}
+	test_hashed_dictionary( );
 	auto const json_data = daw::read_file( argv[1] ).value( );
 	auto coords = calc( json_data );
 	daw::do_not_optimize( coords );